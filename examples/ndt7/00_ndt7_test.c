@@ -0,0 +1,297 @@
+// File: examples/ndt7/00_ndt7_test.c
+// Purpose: ndt7 download and upload against a local server stand-in
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/errno.h>     // for minimk_errno_name
+#include <minimk/ndt7.h>      // for minimk_ndt7_download
+#include <minimk/runtime.h>   // for minimk_runtime_go
+#include <minimk/socket.h>    // for minimk_socket_*
+#include <minimk/syscall.h>   // for minimk_syscall_socket_init
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+#include <minimk/websocket.h> // for minimk_websocket_*
+
+#include <stdio.h>   // for fprintf
+#include <stdlib.h>  // for exit
+#include <string.h>  // for memcmp, strlen
+#include <strings.h> // for strncasecmp
+
+/// Port where the server stand-in listens.
+#define SERVER_PORT "12348"
+
+/// How long the server stand-in keeps sending during the download.
+#define DOWNLOAD_DURATION 1000000000ULL
+
+/// Size of the binary messages the server stand-in sends.
+#define DOWNLOAD_MESSAGE_SIZE 65536
+
+/// Buffers for the server stand-in, which would not fit on a coroutine stack.
+static char server_ring[65536];
+static char server_payload[DOWNLOAD_MESSAGE_SIZE];
+
+/// Number of AppInfo messages the server stand-in received.
+static unsigned server_appinfo = 0;
+
+/// Global variables for test results.
+static int test_passed = 0;
+
+/// Read a frame payload of at most 125 bytes into buffer and unmask it.
+static minimk_error_t server_read_small(minimk_bufreader_t *reader, const minimk_websocket_frame_t *frame,
+                                        char *buffer) {
+    size_t count = (size_t)frame->length;
+    for (size_t off = 0; off < count;) {
+        size_t nread = 0;
+        minimk_error_t rv = minimk_bufreader_read(reader, buffer + off, count - off, &nread);
+        if (rv != 0) {
+            return rv;
+        }
+        off += nread;
+    }
+    if ((frame->flags & MINIMK_WEBSOCKET_FLAG_MASK) != 0) {
+        minimk_websocket_mask(buffer, count, frame->maskkey, 0);
+    }
+    return 0;
+}
+
+/// Read client frames until close, counting the AppInfo messages and binary bytes.
+static minimk_error_t server_read_until_close(minimk_bufreader_t *reader, uint64_t *nbytes) {
+    for (;;) {
+        minimk_websocket_frame_t frame;
+        minimk_error_t rv = minimk_websocket_read_header(reader, &frame);
+        if (rv != 0) {
+            return rv;
+        }
+
+        if ((frame.flags & MINIMK_WEBSOCKET_FLAG_MASK) == 0) {
+            fprintf(stderr, "Server: client sent an unmasked frame\n");
+            return MINIMK_EINVAL;
+        }
+
+        if (frame.opcode == MINIMK_WEBSOCKET_OPCODE_BINARY) {
+            // Skip the payload in place without copying it
+            for (uint64_t left = frame.length; left > 0;) {
+                minimk_iovec_t view;
+                rv = minimk_bufreader_peek(reader, &view);
+                if (rv != 0) {
+                    return rv;
+                }
+                size_t amount = view.len < left ? view.len : (size_t)left;
+                minimk_bufreader_consume(reader, amount);
+                left -= amount;
+            }
+            *nbytes += frame.length;
+            continue;
+        }
+
+        char buffer[125];
+        rv = server_read_small(reader, &frame, buffer);
+        if (rv != 0) {
+            return rv;
+        }
+        if (frame.opcode == MINIMK_WEBSOCKET_OPCODE_CLOSE) {
+            return 0;
+        }
+        static const char prefix[] = "{\"AppInfo\":{\"ElapsedTime\":";
+        if (frame.opcode == MINIMK_WEBSOCKET_OPCODE_TEXT && frame.length >= sizeof(prefix) - 1 &&
+            memcmp(buffer, prefix, sizeof(prefix) - 1) == 0) {
+            server_appinfo++;
+        }
+    }
+}
+
+/// Send a close frame with the normal closure status code.
+static minimk_error_t server_send_close(minimk_socket_t sock) {
+    minimk_websocket_frame_t frame = {2, MINIMK_WEBSOCKET_OPCODE_CLOSE, MINIMK_WEBSOCKET_FLAG_FIN, 0, 0};
+    return minimk_websocket_send_frame(sock, &frame, "\x03\xe8");
+}
+
+/// Perform the server side of the handshake and run the test the client asked for.
+static void server_handle(minimk_socket_t sock) {
+    minimk_bufreader_t reader;
+    minimk_error_t rv = minimk_bufreader_init(&reader, sock, server_ring, sizeof(server_ring));
+    if (rv != 0) {
+        return;
+    }
+
+    // Parse the upgrade request, remembering the path and the key
+    minimk_iovec_t view;
+    rv = minimk_bufreader_read_until(&reader, "\r\n", 2, &view);
+    if (rv != 0) {
+        fprintf(stderr, "Server: cannot read request line: %s\n", minimk_errno_name(rv));
+        return;
+    }
+    static const char download[] = "GET " MINIMK_NDT7_DOWNLOAD_PATH " ";
+    int is_download =
+            view.len >= sizeof(download) - 1 && memcmp(view.base, download, sizeof(download) - 1) == 0;
+
+    char key[64] = {0};
+    for (;;) {
+        rv = minimk_bufreader_read_until(&reader, "\r\n", 2, &view);
+        if (rv != 0) {
+            fprintf(stderr, "Server: cannot read header: %s\n", minimk_errno_name(rv));
+            return;
+        }
+        const char *line = (const char *)view.base;
+        size_t len = view.len - 2;
+        if (len == 0) {
+            break;
+        }
+        static const char name[] = "Sec-WebSocket-Key: ";
+        if (len > sizeof(name) - 1 && len - (sizeof(name) - 1) < sizeof(key) &&
+            strncasecmp(line, name, sizeof(name) - 1) == 0) {
+            memcpy(key, line + sizeof(name) - 1, len - (sizeof(name) - 1));
+        }
+    }
+
+    // Agree to switch protocols
+    char accept[MINIMK_WEBSOCKET_ACCEPT_SIZE];
+    minimk_websocket_accept_key(key, strlen(key), accept);
+    char response[256] = "HTTP/1.1 101 Switching Protocols\r\n"
+                         "Upgrade: websocket\r\n"
+                         "Connection: Upgrade\r\n"
+                         "Sec-WebSocket-Protocol: " MINIMK_NDT7_PROTOCOL "\r\n"
+                         "Sec-WebSocket-Accept: ";
+    strcat(response, accept);
+    strcat(response, "\r\n\r\n");
+    rv = minimk_socket_sendall(sock, response, strlen(response));
+    if (rv != 0) {
+        fprintf(stderr, "Server: cannot send response: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    uint64_t nbytes = 0;
+    if (is_download) {
+        // Send binary messages for a while and then close
+        uint64_t deadline = minimk_time_monotonic_now() + DOWNLOAD_DURATION;
+        minimk_websocket_frame_t frame = {DOWNLOAD_MESSAGE_SIZE, MINIMK_WEBSOCKET_OPCODE_BINARY,
+                                          MINIMK_WEBSOCKET_FLAG_FIN, 0, 0};
+        while (rv == 0 && minimk_time_monotonic_now() < deadline) {
+            rv = minimk_websocket_send_frame(sock, &frame, server_payload);
+            nbytes += DOWNLOAD_MESSAGE_SIZE;
+        }
+        if (rv == 0) {
+            rv = server_send_close(sock);
+        }
+        if (rv == 0) {
+            rv = server_read_until_close(&reader, &nbytes);
+        }
+    } else {
+        // Receive binary messages until the client closes and then confirm
+        rv = server_read_until_close(&reader, &nbytes);
+        if (rv == 0) {
+            rv = server_send_close(sock);
+        }
+    }
+    fprintf(stderr, "Server: %s done with %llu bytes: %s\n", is_download ? "download" : "upload",
+            (unsigned long long)nbytes, minimk_errno_name(rv));
+}
+
+/// Function invoked by the client for each measurement.
+static void client_measurement(void *opaque, const minimk_ndt7_measurement_t *measurement) {
+    unsigned *count = (unsigned *)opaque;
+    (*count)++;
+    fprintf(stderr, "Client: elapsed=%llu us num_bytes=%llu rtt=%llu us\n",
+            (unsigned long long)measurement->elapsed, (unsigned long long)measurement->num_bytes,
+            (unsigned long long)measurement->tcpinfo.rtt);
+}
+
+/// Signature shared by minimk_ndt7_download and minimk_ndt7_upload.
+typedef minimk_error_t (*ndt7_test_func)(const minimk_ndt7_config_t *, const char *,
+                                        minimk_ndt7_measurement_t *);
+
+/// Run one test and check that we transferred data and took measurements.
+static int client_run(const char *name, ndt7_test_func run, const char *path) {
+    unsigned count = 0;
+    minimk_ndt7_config_t config = {0};
+    config.address = "127.0.0.1";
+    config.port = SERVER_PORT;
+    config.host = "127.0.0.1:" SERVER_PORT;
+    config.duration = 1000000000ULL;
+    config.interval = 100000000ULL;
+    config.callback = client_measurement;
+    config.opaque = &count;
+
+    minimk_ndt7_measurement_t result;
+    minimk_error_t rv = run(&config, path, &result);
+    if (rv != 0) {
+        fprintf(stderr, "Client: %s failed: %s\n", name, minimk_errno_name(rv));
+        return 0;
+    }
+
+    uint64_t elapsed = result.elapsed > 0 ? result.elapsed : 1;
+    fprintf(stderr, "Client: %s transferred %llu bytes in %llu us (%llu Mbit/s) with %u measurements\n", name,
+            (unsigned long long)result.num_bytes, (unsigned long long)result.elapsed,
+            (unsigned long long)(result.num_bytes * 8 / elapsed), count);
+    return result.num_bytes > 0 && count > 0;
+}
+
+/// Client coroutine running the download and then the upload.
+static void ndt7_client(void *opaque) {
+    (void)opaque;
+    int ok = client_run("download", minimk_ndt7_download, MINIMK_NDT7_DOWNLOAD_PATH);
+    ok = ok && client_run("upload", minimk_ndt7_upload, MINIMK_NDT7_UPLOAD_PATH);
+    test_passed = ok;
+}
+
+/// Server coroutine accepting the download and the upload connections in turn.
+static void ndt7_server(void *opaque) {
+    minimk_socket_t server_sock = (minimk_socket_t)opaque;
+
+    // Start the client coroutine now that server is listening
+    minimk_runtime_go(ndt7_client, NULL);
+
+    for (int idx = 0; idx < 2; idx++) {
+        minimk_socket_t client_sock = MINIMK_SOCKET_INVALID;
+        minimk_error_t rv = minimk_socket_accept(&client_sock, server_sock);
+        if (rv != 0) {
+            fprintf(stderr, "Server: Accept failed: %s\n", minimk_errno_name(rv));
+            return;
+        }
+        server_handle(client_sock);
+        minimk_socket_destroy(&client_sock);
+    }
+}
+
+int main(void) {
+    // Initialize socket library
+    minimk_error_t rv = minimk_syscall_socket_init();
+    if (rv != 0) {
+        fprintf(stderr, "Socket init failed: %s\n", minimk_errno_name(rv));
+        exit(1);
+    }
+
+    // Create and configure server socket
+    static minimk_socket_t server_sock = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&server_sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    if (rv == 0) {
+        rv = minimk_socket_setsockopt_reuseaddr(server_sock);
+    }
+    if (rv == 0) {
+        rv = minimk_socket_bind(server_sock, "127.0.0.1", SERVER_PORT);
+    }
+    if (rv == 0) {
+        rv = minimk_socket_listen(server_sock, 1);
+    }
+    if (rv != 0) {
+        fprintf(stderr, "Server setup failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&server_sock);
+        exit(1);
+    }
+
+    // Start only the server coroutine - it will start the client when ready
+    minimk_runtime_go(ndt7_server, (void *)server_sock);
+
+    // Run the event loop
+    minimk_runtime_run();
+
+    // Cleanup
+    minimk_socket_destroy(&server_sock);
+
+    if (test_passed && server_appinfo > 0) {
+        fprintf(stderr, "\n=== NDT7 TEST PASSED ===\n");
+        return 0;
+    } else {
+        fprintf(stderr, "\n=== NDT7 TEST FAILED ===\n");
+        return 1;
+    }
+}
@@ -0,0 +1,47 @@
+// File: examples/runtime/03_coroutine_locals.c
+// Purpose: execute coroutines that use coroutine-local storage
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/trace.h>   // for minimk_trace_enable
+
+#include <stdint.h> // for uintptr_t
+#include <stdio.h>  // for fprintf
+
+static size_t trace_id_key;
+
+static void trace_id_destroy(void *value) {
+    fprintf(stderr, "destroy trace_id=%llu\n", (unsigned long long)(uintptr_t)value);
+}
+
+static void worker(void *opaque) {
+    minimk_error_t rv = minimk_runtime_local_set(trace_id_key, opaque);
+    MINIMK_ASSERT(rv == 0);
+
+    for (size_t idx = 0; idx < 4; idx++) {
+        minimk_runtime_nanosleep(100000000);
+        void *value = minimk_runtime_local_get(trace_id_key);
+        MINIMK_ASSERT(value == opaque);
+        fprintf(stderr, "trace_id=%llu\n", (unsigned long long)(uintptr_t)value);
+    }
+}
+
+static void init(void *opaque) {
+    (void)opaque;
+    fprintf(stderr, "init!\n");
+    MINIMK_ASSERT(minimk_runtime_local_get(trace_id_key) == NULL);
+    minimk_runtime_go(worker, (void *)(uintptr_t)1);
+    minimk_runtime_go(worker, (void *)(uintptr_t)2);
+}
+
+int main(void) {
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_COROUTINE;
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_SCHEDULER;
+
+    minimk_error_t rv = minimk_runtime_local_key_create(&trace_id_key, trace_id_destroy);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(init, NULL);
+    minimk_runtime_run();
+}
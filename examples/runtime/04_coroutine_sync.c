@@ -0,0 +1,67 @@
+// File: examples/runtime/04_coroutine_sync.c
+// Purpose: execute coroutines that synchronize using mutex, semaphore and cond
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/trace.h>   // for minimk_trace_enable
+
+#include <stdio.h> // for fprintf
+
+/// Number of workers to create.
+#define NUM_WORKERS 8
+
+/// Maximum number of concurrently active workers.
+#define MAX_ACTIVE 2
+
+static struct minimk_runtime_semaphore sema;
+static struct minimk_runtime_mutex mutex;
+static struct minimk_runtime_cond done;
+static size_t active;
+static size_t finished;
+
+static void worker(void *opaque) {
+    (void)opaque;
+
+    // Cap the number of workers running concurrently
+    minimk_runtime_semaphore_wait(&sema);
+    active++;
+    MINIMK_ASSERT(active <= MAX_ACTIVE);
+    fprintf(stderr, "active=%zu\n", active);
+    minimk_runtime_nanosleep(100000000);
+    active--;
+    minimk_runtime_semaphore_post(&sema);
+
+    // Account for the worker being finished
+    minimk_runtime_mutex_lock(&mutex);
+    finished++;
+    minimk_runtime_cond_signal(&done);
+    minimk_runtime_mutex_unlock(&mutex);
+}
+
+static void init(void *opaque) {
+    (void)opaque;
+    fprintf(stderr, "init!\n");
+    minimk_runtime_semaphore_init(&sema, MAX_ACTIVE);
+
+    for (size_t idx = 0; idx < NUM_WORKERS; idx++) {
+        minimk_error_t rv = minimk_runtime_go(worker, NULL);
+        MINIMK_ASSERT(rv == 0);
+    }
+
+    // Wait for all the workers to finish
+    minimk_runtime_mutex_lock(&mutex);
+    while (finished < NUM_WORKERS) {
+        minimk_runtime_cond_wait(&done, &mutex);
+    }
+    minimk_runtime_mutex_unlock(&mutex);
+    fprintf(stderr, "finished=%zu\n", finished);
+}
+
+int main(void) {
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_COROUTINE;
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_SCHEDULER;
+
+    minimk_runtime_go(init, NULL);
+    minimk_runtime_run();
+}
@@ -0,0 +1,58 @@
+// File: examples/runtime/05_signal_wait.c
+// Purpose: execute a coroutine that waits for a signal to shutdown
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for MINIMK_EINVAL
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/trace.h>   // for minimk_trace_enable
+
+#include <signal.h> // for raise
+#include <stdio.h>  // for fprintf
+
+static int shutting_down;
+
+static void waiter(void *opaque) {
+    (void)opaque;
+
+    // Signals that cannot be blocked would make us wait forever
+    MINIMK_ASSERT(minimk_runtime_signal_wait(SIGKILL) == MINIMK_EINVAL);
+    MINIMK_ASSERT(minimk_runtime_signal_wait(SIGSTOP) == MINIMK_EINVAL);
+
+    minimk_error_t rv = minimk_runtime_signal_wait(SIGTERM);
+    MINIMK_ASSERT(rv == 0);
+    fprintf(stderr, "got SIGTERM, shutting down\n");
+    shutting_down = 1;
+}
+
+static void worker(void *opaque) {
+    (void)opaque;
+    while (!shutting_down) {
+        minimk_runtime_nanosleep(100000000);
+        fprintf(stderr, "working\n");
+    }
+}
+
+static void killer(void *opaque) {
+    (void)opaque;
+    minimk_runtime_nanosleep(500000000);
+    fprintf(stderr, "sending SIGTERM\n");
+    MINIMK_ASSERT(raise(SIGTERM) == 0);
+}
+
+static void init(void *opaque) {
+    (void)opaque;
+    fprintf(stderr, "init!\n");
+    minimk_runtime_go(waiter, NULL);
+    minimk_runtime_go(worker, NULL);
+    minimk_runtime_go(killer, NULL);
+}
+
+int main(void) {
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_COROUTINE;
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_SCHEDULER;
+    minimk_trace_enable |= MINIMK_TRACE_ENABLE_SYSCALL;
+
+    minimk_runtime_go(init, NULL);
+    minimk_runtime_run();
+}
@@ -0,0 +1,123 @@
+// File: examples/socket/02_udp_echo_test.c
+// Purpose: integrated UDP server+client test using batched datagram I/O
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>   // for MINIMK_ASSERT
+#include <minimk/datagram.h> // for minimk_datagram_t
+#include <minimk/errno.h>    // for minimk_errno_name
+#include <minimk/runtime.h>  // for minimk_runtime_go
+#include <minimk/sockaddr.h> // for minimk_sockaddr_parse
+#include <minimk/socket.h>   // for minimk_socket_*
+#include <minimk/syscall.h>  // for minimk_syscall_socket_init
+
+#include <stdio.h>  // for fprintf, snprintf
+#include <string.h> // for memcmp, strlen
+
+/// Number of datagrams exchanged by the test.
+#define NUM_DATAGRAMS 16
+
+/// Size of each datagram buffer.
+#define DATAGRAM_SIZE 64
+
+/// Address where the server listens.
+static minimk_sockaddr_t server_addr;
+
+/// Whether the client received all the echoed datagrams.
+static int test_passed = 0;
+
+/// Client coroutine that sends datagrams one at a time and receives the echoes.
+static void udp_client(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_dgram, 0);
+    MINIMK_ASSERT(rv == 0);
+
+    // Send all the datagrams
+    for (int idx = 0; idx < NUM_DATAGRAMS; idx++) {
+        char msg[DATAGRAM_SIZE];
+        int len = snprintf(msg, sizeof(msg), "datagram #%d", idx);
+        size_t nwritten = 0;
+        rv = minimk_socket_sendto(sock, msg, (size_t)len, &server_addr, &nwritten);
+        MINIMK_ASSERT(rv == 0 && nwritten == (size_t)len);
+    }
+
+    // Receive all the echoes in order
+    int received = 0;
+    for (; received < NUM_DATAGRAMS; received++) {
+        char expect[DATAGRAM_SIZE];
+        int len = snprintf(expect, sizeof(expect), "datagram #%d", received);
+        char buf[DATAGRAM_SIZE];
+        minimk_sockaddr_t from;
+        size_t nread = 0;
+        rv = minimk_socket_recvfrom(sock, buf, sizeof(buf), &from, &nread);
+        if (rv != 0 || nread != (size_t)len || memcmp(buf, expect, nread) != 0) {
+            fprintf(stderr, "Client: bad echo for datagram %d: %s\n", received, minimk_errno_name(rv));
+            break;
+        }
+    }
+
+    fprintf(stderr, "Client: received %d echoed datagrams\n", received);
+    test_passed = (received == NUM_DATAGRAMS);
+    minimk_socket_destroy(&sock);
+}
+
+/// Server coroutine that echoes datagrams back in batches.
+static void udp_server(void *opaque) {
+    minimk_socket_t sock = (minimk_socket_t)opaque;
+
+    // Start the client now that the server is bound
+    minimk_runtime_go(udp_client, NULL);
+
+    static char buffers[NUM_DATAGRAMS][DATAGRAM_SIZE];
+    for (size_t total = 0; total < NUM_DATAGRAMS;) {
+        // Receive as many datagrams as are pending
+        minimk_datagram_t dgrams[NUM_DATAGRAMS];
+        for (size_t idx = 0; idx < NUM_DATAGRAMS; idx++) {
+            dgrams[idx].data = buffers[idx];
+            dgrams[idx].count = DATAGRAM_SIZE;
+        }
+        size_t nrecv = 0;
+        minimk_error_t rv = minimk_socket_recvfrom_many(sock, dgrams, NUM_DATAGRAMS - total, &nrecv);
+        MINIMK_ASSERT(rv == 0 && nrecv > 0);
+        fprintf(stderr, "Server: received batch of %zu datagrams\n", nrecv);
+
+        // Echo them back to their source using the received lengths
+        for (size_t idx = 0; idx < nrecv; idx++) {
+            dgrams[idx].count = dgrams[idx].length;
+        }
+        for (size_t sent = 0; sent < nrecv;) {
+            size_t nsent = 0;
+            rv = minimk_socket_sendto_many(sock, &dgrams[sent], nrecv - sent, &nsent);
+            MINIMK_ASSERT(rv == 0 && nsent > 0);
+            sent += nsent;
+        }
+        total += nrecv;
+    }
+
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    rv = minimk_sockaddr_parse(&server_addr, "127.0.0.1", "12346");
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_dgram, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind_addr(sock, &server_addr);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(udp_server, (void *)sock);
+    minimk_runtime_run();
+
+    if (test_passed) {
+        fprintf(stderr, "\n=== UDP ECHO TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== UDP ECHO TEST FAILED ===\n");
+    return 1;
+}
@@ -0,0 +1,113 @@
+// File: examples/socket/03_reuseport_test.c
+// Purpose: integrated test of SO_REUSEPORT listeners steered by CPU
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/sockopt.h> // for MINIMK_SOCKOPT_REUSEPORT
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+
+#include <stdio.h> // for fprintf
+
+/// Maximum number of CPU IDs we exercise.
+#define MAX_CPUS 64
+
+/// Number of connections we establish from each CPU.
+#define CONNS_PER_CPU 4
+
+/// Listeners of the group, one per CPU plus a spare one that should stay idle.
+static minimk_socket_t listeners[MAX_CPUS + 1];
+
+/// Number of CPU IDs we exercise, which may include CPUs we cannot run on.
+static size_t num_cpus = 0;
+
+/// Whether all the connections reached the listener of their CPU.
+static int test_passed = 0;
+
+/// Driver coroutine that connects from each CPU and accepts on its listener.
+static void driver(void *opaque) {
+    (void)opaque;
+
+    size_t accepted = 0;
+    size_t usable = 0;
+    for (size_t cpu = 0; cpu < num_cpus; cpu++) {
+        // Move to the CPU, so the kernel processes our SYN packets there, skipping
+        // the holes a restricted cpuset leaves in the affinity mask
+        minimk_error_t rv = minimk_syscall_cpu_pin(cpu);
+        if (rv != 0) {
+            fprintf(stderr, "Driver: skipping CPU %zu: %s\n", cpu, minimk_errno_name(rv));
+            continue;
+        }
+        usable++;
+
+        for (int idx = 0; idx < CONNS_PER_CPU; idx++) {
+            minimk_socket_t client = MINIMK_SOCKET_INVALID;
+            rv = minimk_socket_create(&client, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+            MINIMK_ASSERT(rv == 0);
+            rv = minimk_socket_connect(client, "127.0.0.1", "12347");
+            MINIMK_ASSERT(rv == 0);
+
+            // The connection must be pending on the listener of this CPU
+            minimk_socket_t conn = MINIMK_SOCKET_INVALID;
+            rv = minimk_socket_accept(&conn, listeners[cpu]);
+            if (rv != 0) {
+                fprintf(stderr, "Driver: CPU %zu connection %d not steered: %s\n", cpu, idx,
+                        minimk_errno_name(rv));
+                minimk_socket_destroy(&client);
+                return;
+            }
+            accepted++;
+
+            minimk_socket_destroy(&conn);
+            minimk_socket_destroy(&client);
+        }
+        fprintf(stderr, "Driver: CPU %zu connections reached listener %zu\n", cpu, cpu);
+    }
+
+    test_passed = (usable > 0 && accepted == usable * CONNS_PER_CPU);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    // The steering program uses raw CPU IDs, so we need a listener per ID
+    rv = minimk_syscall_cpu_span(&num_cpus);
+    MINIMK_ASSERT(rv == 0 && num_cpus > 0);
+    num_cpus = (num_cpus < MAX_CPUS) ? num_cpus : MAX_CPUS;
+    fprintf(stderr, "Using %zu CPU IDs\n", num_cpus);
+
+    // Create the listeners in CPU order, since this is their index in the group
+    for (size_t idx = 0; idx <= num_cpus; idx++) {
+        rv = minimk_socket_create(&listeners[idx], minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+        MINIMK_ASSERT(rv == 0);
+        rv = minimk_socket_setsockopt(listeners[idx], MINIMK_SOCKOPT_REUSEPORT, 1);
+        MINIMK_ASSERT(rv == 0);
+        rv = minimk_socket_bind(listeners[idx], "127.0.0.1", "12347");
+        MINIMK_ASSERT(rv == 0);
+        rv = minimk_socket_listen(listeners[idx], 16);
+        MINIMK_ASSERT(rv == 0);
+        rv = minimk_socket_set_read_timeout(listeners[idx], 1000000000);
+        MINIMK_ASSERT(rv == 0);
+    }
+
+    // Without steering, the kernel would hash connections to any listener
+    rv = minimk_socket_setsockopt_reuseport_cbpf_cpu(listeners[0]);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(driver, NULL);
+    minimk_runtime_run();
+
+    for (size_t idx = 0; idx <= num_cpus; idx++) {
+        minimk_socket_destroy(&listeners[idx]);
+    }
+
+    if (test_passed) {
+        fprintf(stderr, "\n=== REUSEPORT TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== REUSEPORT TEST FAILED ===\n");
+    return 1;
+}
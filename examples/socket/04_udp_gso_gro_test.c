@@ -0,0 +1,151 @@
+// File: examples/socket/04_udp_gso_gro_test.c
+// Purpose: integrated UDP test sending a GSO batch and splitting GRO buffers
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>   // for MINIMK_ASSERT
+#include <minimk/datagram.h> // for minimk_datagram_segments
+#include <minimk/errno.h>    // for minimk_errno_name
+#include <minimk/runtime.h>  // for minimk_runtime_go
+#include <minimk/sockaddr.h> // for minimk_sockaddr_parse
+#include <minimk/socket.h>   // for minimk_socket_*
+#include <minimk/syscall.h>  // for minimk_syscall_socket_init
+
+#include <stdio.h>  // for fprintf
+#include <string.h> // for memset
+
+/// Size of each datagram the kernel cuts from the GSO buffer.
+#define SEGMENT_SIZE 1200
+
+/// Number of full-size datagrams in the batch.
+#define NUM_FULL_SEGMENTS 8
+
+/// Size of the shorter datagram that ends the batch.
+#define LAST_SEGMENT_SIZE 500
+
+/// Total number of datagrams in the batch.
+#define NUM_SEGMENTS (NUM_FULL_SEGMENTS + 1)
+
+/// Total number of bytes in the batch.
+#define BATCH_SIZE (NUM_FULL_SEGMENTS * SEGMENT_SIZE + LAST_SEGMENT_SIZE)
+
+/// Address where the server listens.
+static minimk_sockaddr_t server_addr;
+
+/// Send and receive buffers, which would not fit on a coroutine stack.
+static unsigned char send_buffer[BATCH_SIZE];
+static unsigned char recv_buffer[65536];
+
+/// Whether the server received every datagram intact and in order.
+static int test_passed = 0;
+
+/// Client coroutine that sends the whole batch with a single GSO send.
+static void gso_client(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_dgram, 0);
+    MINIMK_ASSERT(rv == 0);
+
+    // Fill each datagram with its own index so the server can check the split
+    for (size_t idx = 0; idx < NUM_SEGMENTS; idx++) {
+        size_t len = idx < NUM_FULL_SEGMENTS ? SEGMENT_SIZE : LAST_SEGMENT_SIZE;
+        memset(send_buffer + idx * SEGMENT_SIZE, (int)idx, len);
+    }
+
+    size_t nwritten = 0;
+    rv = minimk_socket_sendto_gso(sock, send_buffer, BATCH_SIZE, &server_addr, SEGMENT_SIZE, &nwritten);
+    fprintf(stderr, "Client: sendto_gso result=%s nwritten=%zu\n", minimk_errno_name(rv), nwritten);
+    MINIMK_ASSERT(rv == 0 && nwritten == BATCH_SIZE);
+
+    minimk_socket_destroy(&sock);
+}
+
+/// Check that a datagram has the expected size and content.
+static int check_segment(const minimk_iovec_t *view, size_t idx) {
+    size_t expect = idx < NUM_FULL_SEGMENTS ? SEGMENT_SIZE : LAST_SEGMENT_SIZE;
+    if (view->len != expect) {
+        fprintf(stderr, "Server: datagram %zu has %zu bytes, expected %zu\n", idx, view->len, expect);
+        return 0;
+    }
+    const unsigned char *data = (const unsigned char *)view->base;
+    for (size_t off = 0; off < view->len; off++) {
+        if (data[off] != (unsigned char)idx) {
+            fprintf(stderr, "Server: datagram %zu is corrupt at offset %zu\n", idx, off);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/// Server coroutine that receives with GRO and splits what it receives.
+static void gro_server(void *opaque) {
+    minimk_socket_t sock = (minimk_socket_t)opaque;
+
+    // Start the client coroutine now that the server is ready
+    minimk_runtime_go(gso_client, NULL);
+
+    size_t received = 0;
+    size_t coalesced = 0;
+    while (received < NUM_SEGMENTS) {
+        minimk_sockaddr_t from;
+        size_t segment_size = 0;
+        size_t nread = 0;
+        minimk_error_t rv = minimk_socket_recvfrom_gro(sock, recv_buffer, sizeof(recv_buffer), &from,
+                                                       &segment_size, &nread);
+        if (rv != 0) {
+            fprintf(stderr, "Server: recvfrom_gro failed: %s\n", minimk_errno_name(rv));
+            break;
+        }
+        fprintf(stderr, "Server: received %zu bytes with segment_size=%zu\n", nread, segment_size);
+
+        // Split the buffer back into the datagrams the client sent
+        minimk_iovec_t views[NUM_SEGMENTS];
+        size_t nviews = minimk_datagram_segments(recv_buffer, nread, segment_size, views, NUM_SEGMENTS);
+        if (nviews > 1) {
+            coalesced++;
+        }
+        size_t idx = 0;
+        for (; idx < nviews && received < NUM_SEGMENTS; idx++, received++) {
+            if (!check_segment(&views[idx], received)) {
+                minimk_socket_destroy(&sock);
+                return;
+            }
+        }
+        if (idx < nviews) {
+            fprintf(stderr, "Server: received more datagrams than sent\n");
+            minimk_socket_destroy(&sock);
+            return;
+        }
+    }
+
+    // The kernel does not promise to coalesce, so we only report it
+    fprintf(stderr, "Server: received %zu datagrams, %zu coalesced buffers\n", received, coalesced);
+    test_passed = received == NUM_SEGMENTS;
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    rv = minimk_sockaddr_parse(&server_addr, "127.0.0.1", "12349");
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_dgram, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_udp_gro(sock);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind_addr(sock, &server_addr);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(gro_server, (void *)sock);
+    minimk_runtime_run();
+
+    if (test_passed) {
+        fprintf(stderr, "\n=== UDP GSO/GRO TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== UDP GSO/GRO TEST FAILED ===\n");
+    return 1;
+}
@@ -0,0 +1,180 @@
+// File: examples/socket/05_zerocopy_test.c
+// Purpose: integrated TCP test sending with MSG_ZEROCOPY and reaping the completions
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+
+#include <stdint.h> // for uint32_t
+#include <stdio.h>  // for fprintf
+#include <string.h> // for memset
+
+/// Size of each buffer we hand to the kernel.
+#define CHUNK_SIZE (256 * 1024)
+
+/// Number of buffers we rotate, such that one is in flight while we fill the other.
+#define NUM_BUFFERS 2
+
+/// Number of chunks the client sends.
+#define NUM_CHUNKS 64
+
+/// Total number of bytes the client sends.
+#define TOTAL_SIZE ((size_t)NUM_CHUNKS * CHUNK_SIZE)
+
+/// Send and receive buffers, which would not fit on a coroutine stack.
+static unsigned char send_buffers[NUM_BUFFERS][CHUNK_SIZE];
+static unsigned char recv_buffer[65536];
+
+/// Whether the client could reuse every buffer after waiting for its completion.
+static int client_passed = 0;
+
+/// Whether the server received every byte intact and in order.
+static int server_passed = 0;
+
+/// Send a whole chunk with zero-copy and return the ID of its last send.
+static minimk_error_t send_chunk(minimk_socket_t sock, const unsigned char *data, uint32_t *last) {
+    size_t off = 0;
+    while (off < CHUNK_SIZE) {
+        size_t nwritten = 0;
+        uint32_t id = 0;
+        minimk_error_t rv = minimk_socket_send_zerocopy(sock, data + off, CHUNK_SIZE - off, &nwritten, &id);
+
+        // Too many completions are pending, so reap up to the newest one and retry
+        if (rv == MINIMK_ENOBUFS) {
+            rv = minimk_socket_zerocopy_wait(sock, *last);
+            if (rv != 0) {
+                return rv;
+            }
+            continue;
+        }
+        if (rv != 0) {
+            return rv;
+        }
+        off += nwritten;
+        *last = id;
+    }
+    return 0;
+}
+
+/// Client coroutine that sends the chunks rotating the buffers.
+static void zerocopy_client(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_zerocopy(sock);
+    if (rv != 0) {
+        fprintf(stderr, "Client: setsockopt_zerocopy failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+    rv = minimk_socket_connect(sock, "127.0.0.1", "12350");
+    if (rv != 0) {
+        fprintf(stderr, "Client: connect failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    uint32_t last_ids[NUM_BUFFERS] = {0};
+    int in_flight[NUM_BUFFERS] = {0};
+    uint32_t last = 0;
+    for (size_t chunk = 0; chunk < NUM_CHUNKS; chunk++) {
+        size_t slot = chunk % NUM_BUFFERS;
+
+        // We must not touch a buffer before the kernel is done with it
+        if (in_flight[slot]) {
+            rv = minimk_socket_zerocopy_wait(sock, last_ids[slot]);
+            if (rv != 0) {
+                fprintf(stderr, "Client: zerocopy_wait failed: %s\n", minimk_errno_name(rv));
+                minimk_socket_destroy(&sock);
+                return;
+            }
+        }
+
+        memset(send_buffers[slot], (int)(chunk & 0xff), CHUNK_SIZE);
+        rv = send_chunk(sock, send_buffers[slot], &last);
+        if (rv != 0) {
+            fprintf(stderr, "Client: send_zerocopy failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+        last_ids[slot] = last;
+        in_flight[slot] = 1;
+    }
+
+    // Wait for the final completion before releasing the buffers
+    rv = minimk_socket_zerocopy_wait(sock, last);
+    fprintf(stderr, "Client: final zerocopy_wait result=%s last_id=%u\n", minimk_errno_name(rv), last);
+    client_passed = rv == 0;
+    minimk_socket_destroy(&sock);
+}
+
+/// Server coroutine that accepts one connection and checks the bytes it receives.
+static void zerocopy_server(void *opaque) {
+    minimk_socket_t listener = (minimk_socket_t)opaque;
+
+    // Start the client coroutine now that the server is listening
+    minimk_runtime_go(zerocopy_client, NULL);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_accept(&sock, listener);
+    if (rv != 0) {
+        fprintf(stderr, "Server: accept failed: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    size_t total = 0;
+    for (;;) {
+        size_t nread = 0;
+        rv = minimk_socket_recv(sock, recv_buffer, sizeof(recv_buffer), &nread);
+        if (rv == MINIMK_EOF) {
+            break;
+        }
+        if (rv != 0) {
+            fprintf(stderr, "Server: recv failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+        for (size_t idx = 0; idx < nread; idx++, total++) {
+            if (recv_buffer[idx] != (unsigned char)((total / CHUNK_SIZE) & 0xff)) {
+                fprintf(stderr, "Server: corrupt byte at offset %zu\n", total);
+                minimk_socket_destroy(&sock);
+                return;
+            }
+        }
+    }
+
+    fprintf(stderr, "Server: received %zu bytes\n", total);
+    server_passed = total == TOTAL_SIZE;
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_socket_t listener = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&listener, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_reuseaddr(listener);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind(listener, "127.0.0.1", "12350");
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_listen(listener, 1);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(zerocopy_server, (void *)listener);
+    minimk_runtime_run();
+    minimk_socket_destroy(&listener);
+
+    if (client_passed && server_passed) {
+        fprintf(stderr, "\n=== ZEROCOPY TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== ZEROCOPY TEST FAILED ===\n");
+    return 1;
+}
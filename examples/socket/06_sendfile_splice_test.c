@@ -0,0 +1,200 @@
+// File: examples/socket/06_sendfile_splice_test.c
+// Purpose: integrated TCP test sending a file with sendfile and a pipe with splice
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+
+#include <errno.h>  // for errno, EAGAIN
+#include <fcntl.h>  // for fcntl, open, O_NONBLOCK
+#include <stdio.h>  // for fprintf
+#include <unistd.h> // for pipe, write, close, unlink
+
+/// Number of bytes we send from the file using sendfile.
+#define FILE_SIZE (4 * 1024 * 1024)
+
+/// Number of bytes we send from the pipe using splice.
+#define PIPE_SIZE (1024 * 1024)
+
+/// Size of each write into the pipe.
+#define PIPE_CHUNK_SIZE (16 * 1024)
+
+/// Total number of bytes the receiver expects.
+#define TOTAL_SIZE (FILE_SIZE + PIPE_SIZE)
+
+/// Staging and receive buffers, which would not fit on a coroutine stack.
+static unsigned char file_buffer[FILE_SIZE];
+static unsigned char pipe_buffer[PIPE_CHUNK_SIZE];
+static unsigned char recv_buffer[65536];
+
+/// Descriptors of the file and of the pipe we send from.
+static int filefd = -1;
+static int pipefds[2] = {-1, -1};
+
+/// Whether the sender could send everything and the receiver got it intact.
+static int sender_passed = 0;
+static int receiver_passed = 0;
+
+/// Returns the expected value of the byte at the given stream offset.
+static unsigned char pattern_at(size_t off) {
+    return (unsigned char)(off % 251);
+}
+
+/// Coroutine that slowly fills the pipe, such that splice must wait for it.
+static void pipe_feeder(void *opaque) {
+    (void)opaque;
+
+    size_t total = FILE_SIZE;
+    while (total < TOTAL_SIZE) {
+        for (size_t idx = 0; idx < PIPE_CHUNK_SIZE; idx++) {
+            pipe_buffer[idx] = pattern_at(total + idx);
+        }
+        size_t off = 0;
+        while (off < PIPE_CHUNK_SIZE) {
+            ssize_t rv = write(pipefds[1], pipe_buffer + off, PIPE_CHUNK_SIZE - off);
+            if (rv < 0 && errno == EAGAIN) {
+                minimk_runtime_nanosleep(1000000);
+                continue;
+            }
+            MINIMK_ASSERT(rv > 0);
+            off += (size_t)rv;
+        }
+        total += PIPE_CHUNK_SIZE;
+        minimk_runtime_nanosleep(1000000);
+    }
+
+    // Closing the write end lets splice return MINIMK_EOF
+    close(pipefds[1]);
+}
+
+/// Coroutine that connects and sends the file and then the pipe content.
+static void sender(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_connect(sock, "127.0.0.1", "12351");
+    if (rv != 0) {
+        fprintf(stderr, "Sender: connect failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    // The file offset is ours to advance, since sendfile does not change it
+    uint64_t offset = 0;
+    for (;;) {
+        size_t nwritten = 0;
+        rv = minimk_socket_sendfile(sock, filefd, offset, FILE_SIZE, &nwritten);
+        if (rv != 0) {
+            break;
+        }
+        offset += nwritten;
+    }
+    fprintf(stderr, "Sender: sendfile result=%s offset=%llu\n", minimk_errno_name(rv),
+            (unsigned long long)offset);
+    if (rv != MINIMK_EOF || offset != FILE_SIZE) {
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    // Only start feeding the pipe now, so we exercise waiting for it
+    minimk_runtime_go(pipe_feeder, NULL);
+    size_t spliced = 0;
+    for (;;) {
+        size_t nwritten = 0;
+        rv = minimk_socket_splice(sock, pipefds[0], PIPE_SIZE, &nwritten);
+        if (rv != 0) {
+            break;
+        }
+        spliced += nwritten;
+    }
+    fprintf(stderr, "Sender: splice result=%s spliced=%zu\n", minimk_errno_name(rv), spliced);
+    sender_passed = rv == MINIMK_EOF && spliced == PIPE_SIZE;
+    minimk_socket_destroy(&sock);
+}
+
+/// Coroutine that accepts one connection and checks the bytes it receives.
+static void receiver(void *opaque) {
+    minimk_socket_t listener = (minimk_socket_t)opaque;
+
+    // Start the sender coroutine now that the receiver is listening
+    minimk_runtime_go(sender, NULL);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_accept(&sock, listener);
+    if (rv != 0) {
+        fprintf(stderr, "Receiver: accept failed: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    size_t total = 0;
+    for (;;) {
+        size_t nread = 0;
+        rv = minimk_socket_recv(sock, recv_buffer, sizeof(recv_buffer), &nread);
+        if (rv == MINIMK_EOF) {
+            break;
+        }
+        if (rv != 0) {
+            fprintf(stderr, "Receiver: recv failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+        for (size_t idx = 0; idx < nread; idx++, total++) {
+            if (recv_buffer[idx] != pattern_at(total)) {
+                fprintf(stderr, "Receiver: corrupt byte at offset %zu\n", total);
+                minimk_socket_destroy(&sock);
+                return;
+            }
+        }
+    }
+
+    fprintf(stderr, "Receiver: received %zu bytes\n", total);
+    receiver_passed = total == TOTAL_SIZE;
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    // Prepare the file sendfile reads from
+    for (size_t idx = 0; idx < FILE_SIZE; idx++) {
+        file_buffer[idx] = pattern_at(idx);
+    }
+    const char *path = "/tmp/minimk_06_sendfile_splice_test.bin";
+    filefd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    MINIMK_ASSERT(filefd >= 0);
+    MINIMK_ASSERT(unlink(path) == 0);
+    MINIMK_ASSERT(write(filefd, file_buffer, FILE_SIZE) == FILE_SIZE);
+
+    // Prepare the pipe splice reads from, which the feeder must not block on
+    MINIMK_ASSERT(pipe(pipefds) == 0);
+    MINIMK_ASSERT(fcntl(pipefds[1], F_SETFL, O_NONBLOCK) == 0);
+
+    minimk_socket_t listener = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&listener, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_reuseaddr(listener);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind(listener, "127.0.0.1", "12351");
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_listen(listener, 1);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(receiver, (void *)listener);
+    minimk_runtime_run();
+    minimk_socket_destroy(&listener);
+    close(pipefds[0]);
+    close(filefd);
+
+    if (sender_passed && receiver_passed) {
+        fprintf(stderr, "\n=== SENDFILE/SPLICE TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== SENDFILE/SPLICE TEST FAILED ===\n");
+    return 1;
+}
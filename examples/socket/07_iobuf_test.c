@@ -0,0 +1,204 @@
+// File: examples/socket/07_iobuf_test.c
+// Purpose: integrated TCP test framing iobuf chains and sending them without copying
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/iobuf.h>   // for minimk_iobuf_t
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+
+#include <stdio.h>  // for fprintf
+#include <string.h> // for memcpy, strlen
+
+/// Number of payload bytes we append, which spans several blocks.
+#define PAYLOAD_SIZE 40000
+
+/// Number of payload bytes that go into the front half.
+#define SPLIT_SIZE 20000
+
+/// Number of payload bytes we drop from the beginning of the back half.
+#define DROP_SIZE 100
+
+/// Headers and trailer we add around the two halves.
+static const char front_header[] = "FRONT-HEADER";
+static const char back_header[] = "BACK-HEADER";
+static const char front_trailer[] = "FRONT-TRAILER";
+
+/// Payload we append, bytes we expect to receive, and receive buffer.
+static unsigned char payload[PAYLOAD_SIZE];
+static unsigned char expected[PAYLOAD_SIZE + 64];
+static unsigned char recv_buffer[65536];
+
+/// Number of bytes we expect to receive.
+static size_t expected_size = 0;
+
+/// Whether the chains behaved as expected and the receiver got every byte intact.
+static int sender_passed = 0;
+static int receiver_passed = 0;
+
+/// Append count bytes from data to the expected stream.
+static void expect(const void *data, size_t count) {
+    memcpy(expected + expected_size, data, count);
+    expected_size += count;
+}
+
+/// Build the front and back chains, checking how they share and allocate blocks.
+static int build_chains(minimk_iobuf_t *front, minimk_iobuf_t *back) {
+    // Appending past a block must chain more blocks
+    MINIMK_ASSERT(minimk_iobuf_append(back, payload, PAYLOAD_SIZE) == 0);
+    MINIMK_ASSERT(back->len == PAYLOAD_SIZE);
+    if (back->nsegs < 3) {
+        fprintf(stderr, "Sender: expected at least 3 segments, got %zu\n", back->nsegs);
+        return 0;
+    }
+
+    // Splitting inside a segment makes both chains reference its block
+    MINIMK_ASSERT(minimk_iobuf_split(back, SPLIT_SIZE, front) == 0);
+    MINIMK_ASSERT(front->len == SPLIT_SIZE);
+    MINIMK_ASSERT(back->len == PAYLOAD_SIZE - SPLIT_SIZE);
+    if (front->tail->block != back->head->block) {
+        fprintf(stderr, "Sender: the split point did not fall inside a segment\n");
+        return 0;
+    }
+
+    // Dropping trims the first segment of the back half
+    MINIMK_ASSERT(minimk_iobuf_drop(back, DROP_SIZE) == 0);
+    MINIMK_ASSERT(back->len == PAYLOAD_SIZE - SPLIT_SIZE - DROP_SIZE);
+
+    // The front half starts at the headroom of the first block, so prepending reuses it
+    size_t nsegs = front->nsegs;
+    MINIMK_ASSERT(minimk_iobuf_prepend(front, front_header, strlen(front_header)) == 0);
+    if (front->nsegs != nsegs) {
+        fprintf(stderr, "Sender: prepending to the front half did not use the headroom\n");
+        return 0;
+    }
+
+    // The back half starts inside the shared block, so prepending needs a new block
+    nsegs = back->nsegs;
+    MINIMK_ASSERT(minimk_iobuf_prepend(back, back_header, strlen(back_header)) == 0);
+    if (back->nsegs != nsegs + 1) {
+        fprintf(stderr, "Sender: prepending to the back half overwrote the shared block\n");
+        return 0;
+    }
+
+    // The front half ends inside the shared block, so appending needs a new block
+    nsegs = front->nsegs;
+    MINIMK_ASSERT(minimk_iobuf_append(front, front_trailer, strlen(front_trailer)) == 0);
+    if (front->nsegs != nsegs + 1) {
+        fprintf(stderr, "Sender: appending to the front half overwrote the shared block\n");
+        return 0;
+    }
+    return 1;
+}
+
+/// Coroutine that connects, builds the chains, and sends them.
+static void sender(void *opaque) {
+    (void)opaque;
+
+    minimk_iobuf_t front;
+    minimk_iobuf_init(&front);
+    minimk_iobuf_t back;
+    minimk_iobuf_init(&back);
+    int chains_ok = build_chains(&front, &back);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_connect(sock, "127.0.0.1", "12352");
+    if (rv != 0) {
+        fprintf(stderr, "Sender: connect failed: %s\n", minimk_errno_name(rv));
+        minimk_iobuf_clear(&front);
+        minimk_iobuf_clear(&back);
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    // Each send consumes its chain as the kernel accepts the data
+    rv = minimk_socket_sendall_iobuf(sock, &front);
+    if (rv == 0) {
+        rv = minimk_socket_sendall_iobuf(sock, &back);
+    }
+    fprintf(stderr, "Sender: sendall_iobuf result=%s\n", minimk_errno_name(rv));
+    sender_passed = chains_ok && rv == 0 && front.len == 0 && back.len == 0;
+    minimk_iobuf_clear(&front);
+    minimk_iobuf_clear(&back);
+    minimk_socket_destroy(&sock);
+}
+
+/// Coroutine that accepts one connection and checks the bytes it receives.
+static void receiver(void *opaque) {
+    minimk_socket_t listener = (minimk_socket_t)opaque;
+
+    // Start the sender coroutine now that the receiver is listening
+    minimk_runtime_go(sender, NULL);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_accept(&sock, listener);
+    if (rv != 0) {
+        fprintf(stderr, "Receiver: accept failed: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    size_t total = 0;
+    for (;;) {
+        size_t nread = 0;
+        rv = minimk_socket_recv(sock, recv_buffer, sizeof(recv_buffer), &nread);
+        if (rv == MINIMK_EOF) {
+            break;
+        }
+        if (rv != 0) {
+            fprintf(stderr, "Receiver: recv failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+        for (size_t idx = 0; idx < nread; idx++, total++) {
+            if (total >= expected_size || recv_buffer[idx] != expected[total]) {
+                fprintf(stderr, "Receiver: unexpected byte at offset %zu\n", total);
+                minimk_socket_destroy(&sock);
+                return;
+            }
+        }
+    }
+
+    fprintf(stderr, "Receiver: received %zu bytes\n", total);
+    receiver_passed = total == expected_size;
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    // Prepare the payload and the stream the receiver should see
+    for (size_t idx = 0; idx < PAYLOAD_SIZE; idx++) {
+        payload[idx] = (unsigned char)(idx % 251);
+    }
+    expect(front_header, strlen(front_header));
+    expect(payload, SPLIT_SIZE);
+    expect(front_trailer, strlen(front_trailer));
+    expect(back_header, strlen(back_header));
+    expect(payload + SPLIT_SIZE + DROP_SIZE, PAYLOAD_SIZE - SPLIT_SIZE - DROP_SIZE);
+
+    minimk_socket_t listener = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&listener, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_reuseaddr(listener);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind(listener, "127.0.0.1", "12352");
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_listen(listener, 1);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(receiver, (void *)listener);
+    minimk_runtime_run();
+    minimk_socket_destroy(&listener);
+
+    if (sender_passed && receiver_passed) {
+        fprintf(stderr, "\n=== IOBUF TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== IOBUF TEST FAILED ===\n");
+    return 1;
+}
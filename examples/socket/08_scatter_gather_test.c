@@ -0,0 +1,200 @@
+// File: examples/socket/08_scatter_gather_test.c
+// Purpose: integrated TCP test gathering messages with sendallv and scattering them with recvv
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/iovec.h>   // for minimk_iovec_t
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+
+#include <stdio.h>  // for fprintf
+#include <string.h> // for memcpy
+
+/// Number of messages the client sends.
+#define NUM_MESSAGES 8
+
+/// Size of the header preceding each message body.
+#define HEADER_SIZE 6
+
+/// Size of each message body, which the kernel may accept in several writes.
+#define BODY_SIZE 100000
+
+/// Offset between the bodies of consecutive messages inside the payload.
+#define BODY_STRIDE 1000
+
+/// Trailer following each message body.
+static const char trailer[] = "END\n";
+
+/// Size of the trailer without the terminating zero.
+#define TRAILER_SIZE (sizeof(trailer) - 1)
+
+/// Size of each message on the wire.
+#define MESSAGE_SIZE (HEADER_SIZE + BODY_SIZE + TRAILER_SIZE)
+
+/// Size of the payload from which we take the bodies.
+#define PAYLOAD_SIZE (BODY_SIZE + NUM_MESSAGES * BODY_STRIDE)
+
+/// Payload, stream the server expects, and the buffers the server scatters into.
+static unsigned char payload[PAYLOAD_SIZE];
+static unsigned char expected[NUM_MESSAGES * MESSAGE_SIZE];
+static unsigned char small_buffer[7];
+static unsigned char medium_buffer[4093];
+static unsigned char large_buffer[65536];
+
+/// Whether the client sent every message and the server got them intact.
+static int client_passed = 0;
+static int server_passed = 0;
+
+/// Fill the header of the given message.
+static void make_header(unsigned char *header, size_t msg) {
+    memcpy(header, "MSG-", 4);
+    header[4] = (unsigned char)('0' + msg);
+    header[5] = '\n';
+}
+
+/// Client coroutine that gathers each message from three separate buffers.
+static void client(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_connect(sock, "127.0.0.1", "12353");
+    if (rv != 0) {
+        fprintf(stderr, "Client: connect failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    // Buffers without any byte to send are invalid
+    minimk_iovec_t empty[2] = {{payload, 0}, {payload, 0}};
+    size_t nwritten = 0;
+    rv = minimk_socket_sendv(sock, empty, 2, &nwritten);
+    if (rv != MINIMK_EINVAL) {
+        fprintf(stderr, "Client: sendv of empty buffers returned %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    for (size_t msg = 0; msg < NUM_MESSAGES; msg++) {
+        unsigned char header[HEADER_SIZE];
+        make_header(header, msg);
+
+        // The array is advanced in place across partial writes, so rebuild it each time
+        minimk_iovec_t iov[3] = {
+                {header, HEADER_SIZE},
+                {payload + msg * BODY_STRIDE, BODY_SIZE},
+                {(void *)trailer, TRAILER_SIZE},
+        };
+        rv = minimk_socket_sendallv(sock, iov, 3);
+        if (rv != 0) {
+            fprintf(stderr, "Client: sendallv failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+    }
+
+    fprintf(stderr, "Client: sent %d messages\n", NUM_MESSAGES);
+    client_passed = 1;
+    minimk_socket_destroy(&sock);
+}
+
+/// Server coroutine that scatters the stream into three buffers of different sizes.
+static void server(void *opaque) {
+    minimk_socket_t listener = (minimk_socket_t)opaque;
+
+    // Start the client coroutine now that the server is listening
+    minimk_runtime_go(client, NULL);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_accept(&sock, listener);
+    if (rv != 0) {
+        fprintf(stderr, "Server: accept failed: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    // Buffers without room for any byte are invalid
+    minimk_iovec_t empty[1] = {{small_buffer, 0}};
+    size_t nread = 0;
+    rv = minimk_socket_recvv(sock, empty, 1, &nread);
+    if (rv != MINIMK_EINVAL) {
+        fprintf(stderr, "Server: recvv of empty buffers returned %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    size_t total = 0;
+    for (;;) {
+        minimk_iovec_t iov[3] = {
+                {small_buffer, sizeof(small_buffer)},
+                {medium_buffer, sizeof(medium_buffer)},
+                {large_buffer, sizeof(large_buffer)},
+        };
+        rv = minimk_socket_recvv(sock, iov, 3, &nread);
+        if (rv == MINIMK_EOF) {
+            break;
+        }
+        if (rv != 0) {
+            fprintf(stderr, "Server: recvv failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+
+        // The kernel fills the buffers in order, so walk them in order
+        for (size_t idx = 0; idx < 3 && nread > 0; idx++) {
+            size_t amount = (nread < iov[idx].len) ? nread : iov[idx].len;
+            const unsigned char *data = (const unsigned char *)iov[idx].base;
+            for (size_t off = 0; off < amount; off++, total++) {
+                if (total >= sizeof(expected) || data[off] != expected[total]) {
+                    fprintf(stderr, "Server: unexpected byte at offset %zu\n", total);
+                    minimk_socket_destroy(&sock);
+                    return;
+                }
+            }
+            nread -= amount;
+        }
+    }
+
+    fprintf(stderr, "Server: received %zu bytes\n", total);
+    server_passed = total == sizeof(expected);
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    // Prepare the payload and the stream the server should see
+    for (size_t idx = 0; idx < PAYLOAD_SIZE; idx++) {
+        payload[idx] = (unsigned char)(idx % 251);
+    }
+    for (size_t msg = 0; msg < NUM_MESSAGES; msg++) {
+        unsigned char *base = expected + msg * MESSAGE_SIZE;
+        make_header(base, msg);
+        memcpy(base + HEADER_SIZE, payload + msg * BODY_STRIDE, BODY_SIZE);
+        memcpy(base + HEADER_SIZE + BODY_SIZE, trailer, TRAILER_SIZE);
+    }
+
+    minimk_socket_t listener = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&listener, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_reuseaddr(listener);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind(listener, "127.0.0.1", "12353");
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_listen(listener, 1);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(server, (void *)listener);
+    minimk_runtime_run();
+    minimk_socket_destroy(&listener);
+
+    if (client_passed && server_passed) {
+        fprintf(stderr, "\n=== SCATTER/GATHER TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== SCATTER/GATHER TEST FAILED ===\n");
+    return 1;
+}
@@ -0,0 +1,245 @@
+// File: examples/socket/09_ratelimit_test.c
+// Purpose: integrated test shaping TCP sends, TCP receives, and UDP sends with token buckets
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>    // for MINIMK_ASSERT
+#include <minimk/errno.h>     // for minimk_errno_name
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/runtime.h>   // for minimk_runtime_go
+#include <minimk/sockaddr.h>  // for minimk_sockaddr_parse
+#include <minimk/socket.h>    // for minimk_socket_*
+#include <minimk/syscall.h>   // for minimk_syscall_socket_init
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+
+#include <stdint.h> // for uint64_t
+#include <stdio.h>  // for fprintf
+
+/// Number of bytes we transfer in each shaped stream phase.
+#define STREAM_SIZE (256 * 1024)
+
+/// Rate and burst of the stream limiters.
+#define STREAM_RATE 1000000
+#define STREAM_BURST (64 * 1024)
+
+/// Number and size of the datagrams we send.
+#define NUM_DATAGRAMS 20
+#define DATAGRAM_SIZE 1000
+
+/// Rate and burst of the datagram limiter.
+#define DATAGRAM_RATE 100000
+#define DATAGRAM_BURST 4096
+
+/// Number of nanoseconds in a second.
+#define NANOSEC_PER_SEC 1000000000ULL
+
+/// Send and receive buffers, which would not fit on a coroutine stack.
+static unsigned char send_buffer[STREAM_SIZE];
+static unsigned char recv_buffer[65536];
+
+/// Limiters for the stream sender, the stream receiver, and the datagram sender.
+static minimk_ratelimit_t stream_send_limit;
+static minimk_ratelimit_t stream_recv_limit;
+static minimk_ratelimit_t datagram_limit;
+
+/// Address the datagram receiver binds to.
+static minimk_sockaddr_t datagram_addr;
+
+/// Whether each shaped transfer took the expected time.
+static int send_passed = 0;
+static int recv_passed = 0;
+static int sendto_passed = 0;
+
+/// Whether the datagram receiver got every datagram.
+static int datagrams_passed = 0;
+
+/// Check that transferring bytes took about the time needed to refill all but the burst.
+static int check_elapsed(const char *what, uint64_t elapsed, uint64_t bytes, uint64_t rate, uint64_t burst) {
+    uint64_t expected = (bytes - burst) * NANOSEC_PER_SEC / rate;
+    fprintf(stderr, "%s: elapsed=%llu ns expected=%llu ns\n", what, (unsigned long long)elapsed,
+            (unsigned long long)expected);
+    return elapsed >= expected - expected / 10 && elapsed <= expected * 2;
+}
+
+/// Client coroutine that sends a shaped phase and then an unshaped one.
+static void stream_client(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_connect(sock, "127.0.0.1", "12354");
+    if (rv != 0) {
+        fprintf(stderr, "Stream client: connect failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    // The bucket starts full, so only the bytes beyond the burst wait for tokens
+    MINIMK_ASSERT(minimk_socket_set_send_ratelimit(sock, &stream_send_limit) == 0);
+    uint64_t start = minimk_time_monotonic_now();
+    rv = minimk_socket_sendall(sock, send_buffer, STREAM_SIZE);
+    uint64_t elapsed = minimk_time_monotonic_now() - start;
+    if (rv != 0) {
+        fprintf(stderr, "Stream client: shaped sendall failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+    send_passed = check_elapsed("Stream client: send", elapsed, STREAM_SIZE, STREAM_RATE, STREAM_BURST);
+
+    // Let the server shape the second phase while receiving
+    MINIMK_ASSERT(minimk_socket_set_send_ratelimit(sock, NULL) == 0);
+    rv = minimk_socket_sendall(sock, send_buffer, STREAM_SIZE);
+    if (rv != 0) {
+        fprintf(stderr, "Stream client: unshaped sendall failed: %s\n", minimk_errno_name(rv));
+    }
+    minimk_socket_destroy(&sock);
+}
+
+/// Receive exactly count bytes, returning zero on success.
+static minimk_error_t recv_exactly(minimk_socket_t sock, size_t count) {
+    while (count > 0) {
+        size_t want = (count < sizeof(recv_buffer)) ? count : sizeof(recv_buffer);
+        size_t nread = 0;
+        minimk_error_t rv = minimk_socket_recv(sock, recv_buffer, want, &nread);
+        if (rv != 0) {
+            return rv;
+        }
+        count -= nread;
+    }
+    return 0;
+}
+
+/// Server coroutine that receives the unshaped first phase and shapes the second one.
+static void stream_server(void *opaque) {
+    minimk_socket_t listener = (minimk_socket_t)opaque;
+
+    // Start the client coroutine now that the server is listening
+    minimk_runtime_go(stream_client, NULL);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_accept(&sock, listener);
+    if (rv != 0) {
+        fprintf(stderr, "Stream server: accept failed: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    // Read the first phase without shaping, never reading into the second one
+    rv = recv_exactly(sock, STREAM_SIZE);
+    if (rv != 0) {
+        fprintf(stderr, "Stream server: unshaped recv failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    MINIMK_ASSERT(minimk_socket_set_recv_ratelimit(sock, &stream_recv_limit) == 0);
+    uint64_t start = minimk_time_monotonic_now();
+    rv = recv_exactly(sock, STREAM_SIZE);
+    uint64_t elapsed = minimk_time_monotonic_now() - start;
+    if (rv != 0) {
+        fprintf(stderr, "Stream server: shaped recv failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+    recv_passed = check_elapsed("Stream server: recv", elapsed, STREAM_SIZE, STREAM_RATE, STREAM_BURST);
+    minimk_socket_destroy(&sock);
+}
+
+/// Coroutine that sends shaped datagrams, which cannot be split.
+static void datagram_sender(void *opaque) {
+    (void)opaque;
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_dgram, 0);
+    MINIMK_ASSERT(rv == 0);
+    MINIMK_ASSERT(minimk_socket_set_send_ratelimit(sock, &datagram_limit) == 0);
+
+    // A datagram larger than the burst could never be sent
+    size_t nwritten = 0;
+    rv = minimk_socket_sendto(sock, send_buffer, DATAGRAM_BURST + 1, &datagram_addr, &nwritten);
+    if (rv != MINIMK_EINVAL) {
+        fprintf(stderr, "Datagram sender: oversized sendto returned %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sock);
+        return;
+    }
+
+    uint64_t start = minimk_time_monotonic_now();
+    for (size_t idx = 0; idx < NUM_DATAGRAMS; idx++) {
+        rv = minimk_socket_sendto(sock, send_buffer, DATAGRAM_SIZE, &datagram_addr, &nwritten);
+        if (rv != 0 || nwritten != DATAGRAM_SIZE) {
+            fprintf(stderr, "Datagram sender: sendto failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+    }
+    uint64_t elapsed = minimk_time_monotonic_now() - start;
+    sendto_passed = check_elapsed("Datagram sender: sendto", elapsed, NUM_DATAGRAMS * DATAGRAM_SIZE,
+                                  DATAGRAM_RATE, DATAGRAM_BURST);
+    minimk_socket_destroy(&sock);
+}
+
+/// Coroutine that counts the datagrams it receives.
+static void datagram_receiver(void *opaque) {
+    minimk_socket_t sock = (minimk_socket_t)opaque;
+
+    // Start the sender coroutine now that the receiver is bound
+    minimk_runtime_go(datagram_sender, NULL);
+
+    // Do not wait forever when datagrams are lost
+    MINIMK_ASSERT(minimk_socket_set_read_timeout(sock, NANOSEC_PER_SEC) == 0);
+    size_t received = 0;
+    while (received < NUM_DATAGRAMS) {
+        minimk_sockaddr_t from;
+        size_t nread = 0;
+        minimk_error_t rv = minimk_socket_recvfrom(sock, recv_buffer, sizeof(recv_buffer), &from, &nread);
+        if (rv != 0) {
+            fprintf(stderr, "Datagram receiver: recvfrom failed: %s\n", minimk_errno_name(rv));
+            break;
+        }
+        if (nread == DATAGRAM_SIZE) {
+            received++;
+        }
+    }
+
+    fprintf(stderr, "Datagram receiver: received %zu datagrams\n", received);
+    datagrams_passed = received == NUM_DATAGRAMS;
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    MINIMK_ASSERT(minimk_ratelimit_init(&stream_send_limit, STREAM_RATE, STREAM_BURST) == 0);
+    MINIMK_ASSERT(minimk_ratelimit_init(&stream_recv_limit, STREAM_RATE, STREAM_BURST) == 0);
+    MINIMK_ASSERT(minimk_ratelimit_init(&datagram_limit, DATAGRAM_RATE, DATAGRAM_BURST) == 0);
+
+    minimk_socket_t listener = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&listener, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_reuseaddr(listener);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind(listener, "127.0.0.1", "12354");
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_listen(listener, 1);
+    MINIMK_ASSERT(rv == 0);
+
+    rv = minimk_sockaddr_parse(&datagram_addr, "127.0.0.1", "12355");
+    MINIMK_ASSERT(rv == 0);
+    minimk_socket_t dgram = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&dgram, minimk_syscall_af_inet, minimk_syscall_sock_dgram, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind_addr(dgram, &datagram_addr);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(stream_server, (void *)listener);
+    minimk_runtime_go(datagram_receiver, (void *)dgram);
+    minimk_runtime_run();
+    minimk_socket_destroy(&listener);
+
+    if (send_passed && recv_passed && sendto_passed && datagrams_passed) {
+        fprintf(stderr, "\n=== RATELIMIT TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== RATELIMIT TEST FAILED ===\n");
+    return 1;
+}
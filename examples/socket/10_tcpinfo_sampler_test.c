@@ -0,0 +1,173 @@
+// File: examples/socket/10_tcpinfo_sampler_test.c
+// Purpose: integrated TCP test sampling TCP_INFO of a transfer into a wrapping ring
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/runtime.h> // for minimk_runtime_go
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_ring_t
+
+#include <stdio.h> // for fprintf
+
+/// Number of samples the ring holds, which the transfer overflows.
+#define RING_CAPACITY 8
+
+/// Nanoseconds between samples.
+#define SAMPLE_INTERVAL 10000000
+
+/// Number of sends and bytes per send.
+#define NUM_SENDS 30
+#define SEND_SIZE 65536
+
+/// Send and receive buffers, which would not fit on a coroutine stack.
+static unsigned char send_buffer[SEND_SIZE];
+static unsigned char recv_buffer[65536];
+
+/// Storage of the ring, the ring, and the sampler filling it.
+static minimk_tcpinfo_t samples[RING_CAPACITY];
+static minimk_tcpinfo_ring_t ring;
+static minimk_socket_t sampled = MINIMK_SOCKET_INVALID;
+static minimk_socket_tcpinfo_sampler_t sampler;
+
+/// Whether the ring contained the expected samples and the server got every byte.
+static int client_passed = 0;
+static int server_passed = 0;
+
+/// Check that the ring wrapped and holds the newest samples in order.
+static int check_ring(void) {
+    fprintf(stderr, "Client: sampled %zu times\n", ring.count);
+    if (ring.count <= RING_CAPACITY) {
+        fprintf(stderr, "Client: the ring did not wrap\n");
+        return 0;
+    }
+    if (minimk_tcpinfo_ring_at(&ring, RING_CAPACITY) != NULL) {
+        fprintf(stderr, "Client: the ring returned more samples than it holds\n");
+        return 0;
+    }
+
+    // The oldest sample comes first and the counters never decrease
+    const minimk_tcpinfo_t *prev = minimk_tcpinfo_ring_at(&ring, 0);
+    MINIMK_ASSERT(prev != NULL);
+    for (size_t idx = 1; idx < RING_CAPACITY; idx++) {
+        const minimk_tcpinfo_t *cur = minimk_tcpinfo_ring_at(&ring, idx);
+        MINIMK_ASSERT(cur != NULL);
+        if (cur->time <= prev->time || cur->bytes_acked < prev->bytes_acked) {
+            fprintf(stderr, "Client: sample %zu is out of order\n", idx);
+            return 0;
+        }
+        prev = cur;
+    }
+    fprintf(stderr, "Client: newest bytes_acked=%llu\n", (unsigned long long)prev->bytes_acked);
+    return prev->bytes_acked > 0;
+}
+
+/// Client coroutine that sends data while the sampler runs.
+static void client(void *opaque) {
+    (void)opaque;
+
+    minimk_error_t rv = minimk_socket_create(&sampled, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_connect(sampled, "127.0.0.1", "12356");
+    if (rv != 0) {
+        fprintf(stderr, "Client: connect failed: %s\n", minimk_errno_name(rv));
+        minimk_socket_destroy(&sampled);
+        return;
+    }
+
+    // Start sampling the socket we send from
+    minimk_tcpinfo_ring_init(&ring, samples, RING_CAPACITY);
+    sampler.socks = &sampled;
+    sampler.rings = &ring;
+    sampler.count = 1;
+    sampler.interval = SAMPLE_INTERVAL;
+    sampler.stop = 0;
+    minimk_runtime_go(minimk_socket_tcpinfo_sampler_run, &sampler);
+
+    // Spread the transfer across many sampling intervals
+    for (size_t idx = 0; idx < NUM_SENDS; idx++) {
+        rv = minimk_socket_sendall(sampled, send_buffer, SEND_SIZE);
+        if (rv != 0) {
+            fprintf(stderr, "Client: sendall failed: %s\n", minimk_errno_name(rv));
+            sampler.stop = 1;
+            minimk_socket_destroy(&sampled);
+            return;
+        }
+        minimk_runtime_nanosleep(SAMPLE_INTERVAL / 2);
+    }
+
+    // Once stopped, the sampler must not take any more samples
+    sampler.stop = 1;
+    minimk_runtime_nanosleep(2 * SAMPLE_INTERVAL);
+    size_t count = ring.count;
+    minimk_runtime_nanosleep(4 * SAMPLE_INTERVAL);
+    if (ring.count != count) {
+        fprintf(stderr, "Client: the sampler did not stop\n");
+        minimk_socket_destroy(&sampled);
+        return;
+    }
+
+    client_passed = check_ring();
+    minimk_socket_destroy(&sampled);
+}
+
+/// Server coroutine that accepts one connection and drains it.
+static void server(void *opaque) {
+    minimk_socket_t listener = (minimk_socket_t)opaque;
+
+    // Start the client coroutine now that the server is listening
+    minimk_runtime_go(client, NULL);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    minimk_error_t rv = minimk_socket_accept(&sock, listener);
+    if (rv != 0) {
+        fprintf(stderr, "Server: accept failed: %s\n", minimk_errno_name(rv));
+        return;
+    }
+
+    size_t total = 0;
+    for (;;) {
+        size_t nread = 0;
+        rv = minimk_socket_recv(sock, recv_buffer, sizeof(recv_buffer), &nread);
+        if (rv == MINIMK_EOF) {
+            break;
+        }
+        if (rv != 0) {
+            fprintf(stderr, "Server: recv failed: %s\n", minimk_errno_name(rv));
+            minimk_socket_destroy(&sock);
+            return;
+        }
+        total += nread;
+    }
+
+    fprintf(stderr, "Server: received %zu bytes\n", total);
+    server_passed = total == (size_t)NUM_SENDS * SEND_SIZE;
+    minimk_socket_destroy(&sock);
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_socket_t listener = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&listener, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_setsockopt_reuseaddr(listener);
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_bind(listener, "127.0.0.1", "12356");
+    MINIMK_ASSERT(rv == 0);
+    rv = minimk_socket_listen(listener, 1);
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_runtime_go(server, (void *)listener);
+    minimk_runtime_run();
+    minimk_socket_destroy(&listener);
+
+    if (client_passed && server_passed) {
+        fprintf(stderr, "\n=== TCPINFO SAMPLER TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== TCPINFO SAMPLER TEST FAILED ===\n");
+    return 1;
+}
@@ -0,0 +1,97 @@
+// File: examples/socket/11_sockopt_test.c
+// Purpose: test setting and getting typed socket options on a TCP socket
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/errno.h>   // for minimk_errno_name
+#include <minimk/socket.h>  // for minimk_socket_*
+#include <minimk/sockopt.h> // for MINIMK_SOCKOPT_*
+#include <minimk/syscall.h> // for minimk_syscall_socket_init
+
+#include <limits.h> // for INT_MAX
+#include <stdint.h> // for uint64_t
+#include <stdio.h>  // for fprintf
+
+/// Identifier of an option that does not exist.
+#define UNKNOWN_SOCKOPT 999
+
+/// Pacing rate that does not fit into 32 bits.
+#define WIDE_PACING_RATE 5000000000ULL
+
+/// Whether every check passed so far.
+static int all_tests_passed = 1;
+
+/// Set the option to value, read it back, and check it equals expected (or twice that when doubled).
+static void check_roundtrip(minimk_socket_t sock, const char *name, minimk_sockopt_t option, uint64_t value,
+                            uint64_t expected, int doubled) {
+    minimk_error_t rv = minimk_socket_setsockopt(sock, option, value);
+    if (rv != 0) {
+        fprintf(stderr, "%s: setsockopt failed: %s\n", name, minimk_errno_name(rv));
+        all_tests_passed = 0;
+        return;
+    }
+    uint64_t got = 0;
+    rv = minimk_socket_getsockopt(sock, option, &got);
+    if (rv != 0) {
+        fprintf(stderr, "%s: getsockopt failed: %s\n", name, minimk_errno_name(rv));
+        all_tests_passed = 0;
+        return;
+    }
+    fprintf(stderr, "%s: set=%llu got=%llu\n", name, (unsigned long long)value, (unsigned long long)got);
+    if (got != expected && !(doubled && got == 2 * expected)) {
+        all_tests_passed = 0;
+    }
+}
+
+/// Check that the given call returned MINIMK_EINVAL.
+static void check_einval(const char *what, minimk_error_t rv) {
+    fprintf(stderr, "%s: result=%s\n", what, minimk_errno_name(rv));
+    if (rv != MINIMK_EINVAL) {
+        all_tests_passed = 0;
+    }
+}
+
+int main(void) {
+    minimk_error_t rv = minimk_syscall_socket_init();
+    MINIMK_ASSERT(rv == 0);
+
+    minimk_socket_t sock = MINIMK_SOCKET_INVALID;
+    rv = minimk_socket_create(&sock, minimk_syscall_af_inet, minimk_syscall_sock_stream, 0);
+    MINIMK_ASSERT(rv == 0);
+
+    // Boolean options read back as one when enabled
+    check_roundtrip(sock, "TCP_NODELAY", MINIMK_SOCKOPT_TCP_NODELAY, 1, 1, 0);
+    check_roundtrip(sock, "TCP_NODELAY", MINIMK_SOCKOPT_TCP_NODELAY, 0, 0, 0);
+
+    // Linux doubles the buffer size to account for bookkeeping overhead
+    check_roundtrip(sock, "SO_SNDBUF", MINIMK_SOCKOPT_SNDBUF, 65536, 65536, 1);
+
+    check_roundtrip(sock, "TCP_NOTSENT_LOWAT", MINIMK_SOCKOPT_TCP_NOTSENT_LOWAT, 16384, 16384, 0);
+
+    // The pacing rate uses a 64 bit value, so it is not capped at 4 GB/s
+    check_roundtrip(sock, "SO_MAX_PACING_RATE", MINIMK_SOCKOPT_MAX_PACING_RATE, WIDE_PACING_RATE,
+                    WIDE_PACING_RATE, 0);
+
+    // Values that do not fit into an int and unknown options are invalid
+    check_einval("TCP_NODELAY above INT_MAX",
+                 minimk_socket_setsockopt(sock, MINIMK_SOCKOPT_TCP_NODELAY, (uint64_t)INT_MAX + 1));
+    check_einval("setsockopt of unknown option", minimk_socket_setsockopt(sock, UNKNOWN_SOCKOPT, 1));
+    uint64_t value = 0;
+    check_einval("getsockopt of unknown option", minimk_socket_getsockopt(sock, UNKNOWN_SOCKOPT, &value));
+
+    // Every Linux kernel provides the cubic congestion control
+    rv = minimk_socket_setsockopt_congestion(sock, "cubic");
+    fprintf(stderr, "TCP_CONGESTION cubic: result=%s\n", minimk_errno_name(rv));
+    if (rv != 0) {
+        all_tests_passed = 0;
+    }
+
+    minimk_socket_destroy(&sock);
+
+    if (all_tests_passed) {
+        fprintf(stderr, "\n=== SOCKOPT TEST PASSED ===\n");
+        return 0;
+    }
+    fprintf(stderr, "\n=== SOCKOPT TEST FAILED ===\n");
+    return 1;
+}
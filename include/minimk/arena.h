@@ -0,0 +1,88 @@
+// File: include/minimk/arena.h
+// Purpose: bump-pointer arena allocator
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_ARENA_H
+#define MINIMK_ARENA_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+/// Default number of bytes in each arena chunk, including its header.
+#define MINIMK_ARENA_DEFAULT_CHUNK_SIZE 65536
+
+/// Memory mapping from which the arena carves allocations (opaque).
+struct minimk_arena_chunk;
+
+/// Bump-pointer allocator with chained chunks.
+///
+/// Allocating advances a cursor inside the current chunk and moves to
+/// another chunk when the current one is exhausted. There is no way to free
+/// individual allocations: minimk_arena_reset releases all of them at once
+/// in constant time, keeping the chunks for reuse, which makes the arena a
+/// good fit for per-request or per-connection state.
+///
+/// Initialize using minimk_arena_init and release using minimk_arena_destroy.
+typedef struct minimk_arena {
+    /// First chunk in the chain or NULL.
+    struct minimk_arena_chunk *first;
+
+    /// Chunk we are allocating from or NULL after a reset.
+    struct minimk_arena_chunk *current;
+
+    /// Next free byte in the current chunk.
+    char *cursor;
+
+    /// One past the last byte of the current chunk.
+    char *limit;
+
+    /// Minimum number of bytes in each new chunk, including its header.
+    size_t chunk_size;
+} minimk_arena_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Initialize an empty arena.
+///
+/// The chunk_size argument is the minimum size of the chunks we map when
+/// we need more memory, including a small header, which we round up to the
+/// page size. Use zero for MINIMK_ARENA_DEFAULT_CHUNK_SIZE.
+///
+/// We do not map any memory until the first allocation.
+void minimk_arena_init(minimk_arena_t *arena, size_t chunk_size) MINIMK_NOEXCEPT;
+
+/// Allocate size bytes aligned to align, which must be a power of two.
+///
+/// Requests larger than the chunk size get a dedicated chunk, and we keep
+/// allocating from the current chunk afterwards. The memory is not
+/// initialized and remains valid until the next reset or destroy.
+///
+/// We return MINIMK_EINVAL when size is zero or align is invalid, and
+/// MINIMK_ENOMEM when we cannot map more memory.
+minimk_error_t minimk_arena_alloc(minimk_arena_t *arena, size_t size, size_t align,
+                                  void **ptr) MINIMK_NOEXCEPT;
+
+/// Release all the allocations in constant time, keeping the chunks for reuse.
+void minimk_arena_reset(minimk_arena_t *arena) MINIMK_NOEXCEPT;
+
+/// Release all the allocations and unmap all the chunks.
+///
+/// The arena is empty afterwards and can be used again.
+void minimk_arena_destroy(minimk_arena_t *arena) MINIMK_NOEXCEPT;
+
+/// Return the arena of the running coroutine, creating it on first use.
+///
+/// The arena uses the default chunk size, and the runtime destroys it when
+/// the coroutine exits, using coroutine-local storage. Coroutines that
+/// never call this function pay nothing.
+///
+/// This function must be called by a running coroutine.
+///
+/// We return MINIMK_EAGAIN when no coroutine-local storage keys are left
+/// and MINIMK_ENOMEM when we cannot allocate the arena.
+minimk_error_t minimk_arena_local(minimk_arena_t **parena) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_ARENA_H
@@ -0,0 +1,113 @@
+// File: include/minimk/bufreader.h
+// Purpose: buffered socket reader with delimiter scanning
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_BUFREADER_H
+#define MINIMK_BUFREADER_H
+
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/cdefs.h>     // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/socket.h>    // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+/// Buffered reader over a socket using a caller-provided ring buffer.
+///
+/// The reader fills the free space of the ring with a single scatter recv
+/// per call, so parsers issue few, large reads instead of many small ones.
+///
+/// Views returned by the reader point directly into the ring and remain
+/// valid until the next call that fills, consumes, or scans the reader.
+///
+/// Initialize using minimk_bufreader_init.
+typedef struct minimk_bufreader {
+    /// Socket we read from.
+    minimk_socket_t sock;
+
+    /// Ring storage owned by the caller.
+    char *base;
+
+    /// Size of the ring storage, which is a power of two.
+    size_t capacity;
+
+    /// Monotonic count of bytes consumed from the ring.
+    size_t head;
+
+    /// Monotonic count of bytes received into the ring.
+    size_t tail;
+
+    /// Optional writer we flush before waiting for input or NULL.
+    minimk_bufwriter_t *writer;
+} minimk_bufreader_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Initialize a buffered reader for the given socket.
+///
+/// The base argument points to capacity bytes of storage that must outlive
+/// the reader. The capacity must be a nonzero power of two.
+///
+/// We return MINIMK_EINVAL when base is NULL or capacity is invalid.
+minimk_error_t minimk_bufreader_init(minimk_bufreader_t *reader, minimk_socket_t sock, void *base,
+                                     size_t capacity) MINIMK_NOEXCEPT;
+
+/// Pair the reader with a writer for the same connection.
+///
+/// Before receiving, we flush the data buffered by the writer, so that a
+/// request is never stuck in our buffer while we wait for its response.
+/// Pass NULL to remove the pairing.
+void minimk_bufreader_set_writer(minimk_bufreader_t *reader, minimk_bufwriter_t *writer) MINIMK_NOEXCEPT;
+
+/// Return the number of bytes currently buffered.
+size_t minimk_bufreader_buffered(const minimk_bufreader_t *reader) MINIMK_NOEXCEPT;
+
+/// Receive more data into the free space of the ring.
+///
+/// This function flushes the paired writer, if any, and then issues a single
+/// scatter recv, suspending the current coroutine until the socket is
+/// readable or the read timeout expires.
+///
+/// We return MINIMK_ENOBUFS when the ring is full and MINIMK_EOF when the
+/// peer has closed the connection.
+minimk_error_t minimk_bufreader_fill(minimk_bufreader_t *reader) MINIMK_NOEXCEPT;
+
+/// Return a contiguous view of the buffered data without consuming it.
+///
+/// When the ring is empty, we fill it first. The view may be shorter than
+/// the buffered data when the data wraps around the end of the ring.
+///
+/// The view is valid until the next call on the reader.
+minimk_error_t minimk_bufreader_peek(minimk_bufreader_t *reader, minimk_iovec_t *view) MINIMK_NOEXCEPT;
+
+/// Discard count bytes from the front of the ring.
+///
+/// We return MINIMK_EINVAL when count exceeds the buffered data.
+minimk_error_t minimk_bufreader_consume(minimk_bufreader_t *reader, size_t count) MINIMK_NOEXCEPT;
+
+/// Read until the given delimiter, such as "\r\n", is buffered.
+///
+/// On success, view is a contiguous view of the data up to and including
+/// the delimiter, which we have already consumed from the ring. The view is
+/// valid until the next call on the reader.
+///
+/// We scan with memchr for the first delimiter byte and never rescan data
+/// that we already scanned while waiting for more input.
+///
+/// We return MINIMK_EINVAL when the delimiter is empty or larger than the
+/// ring, and MINIMK_ENOBUFS when the ring fills up without a delimiter.
+minimk_error_t minimk_bufreader_read_until(minimk_bufreader_t *reader, const char *delim, size_t delimlen,
+                                           minimk_iovec_t *view) MINIMK_NOEXCEPT;
+
+/// Copy up to count bytes of buffered data into data.
+///
+/// When the ring is empty, we fill it first. On success, nread contains
+/// the number of bytes copied, which is always positive.
+///
+/// We return MINIMK_EINVAL when count is zero.
+minimk_error_t minimk_bufreader_read(minimk_bufreader_t *reader, void *data, size_t count,
+                                     size_t *nread) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_BUFREADER_H
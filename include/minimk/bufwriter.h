@@ -0,0 +1,73 @@
+// File: include/minimk/bufwriter.h
+// Purpose: buffered socket writer coalescing small writes
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_BUFWRITER_H
+#define MINIMK_BUFWRITER_H
+
+#include <minimk/cdefs.h>  // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+/// Buffered writer over a socket using caller-provided storage.
+///
+/// Small writes accumulate in the buffer and reach the kernel together when
+/// the buffered data reaches the flush threshold, when the caller invokes
+/// minimk_bufwriter_flush, or before a paired minimk_bufreader_t waits for
+/// input. Writes that do not fit travel along with the buffered data using
+/// a single writev, without copying.
+///
+/// Initialize using minimk_bufwriter_init.
+typedef struct minimk_bufwriter {
+    /// Socket we write to.
+    minimk_socket_t sock;
+
+    /// Buffer storage owned by the caller.
+    char *base;
+
+    /// Size of the buffer storage.
+    size_t capacity;
+
+    /// Number of bytes currently buffered.
+    size_t len;
+
+    /// Number of buffered bytes that triggers an automatic flush.
+    size_t threshold;
+} minimk_bufwriter_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Initialize a buffered writer for the given socket.
+///
+/// The base argument points to capacity bytes of storage that must outlive
+/// the writer. The flush threshold defaults to the capacity.
+///
+/// We return MINIMK_EINVAL when base is NULL or capacity is zero.
+minimk_error_t minimk_bufwriter_init(minimk_bufwriter_t *writer, minimk_socket_t sock, void *base,
+                                     size_t capacity) MINIMK_NOEXCEPT;
+
+/// Set the number of buffered bytes that triggers an automatic flush.
+///
+/// We return MINIMK_EINVAL when threshold is zero or exceeds the capacity.
+minimk_error_t minimk_bufwriter_set_threshold(minimk_bufwriter_t *writer, size_t threshold) MINIMK_NOEXCEPT;
+
+/// Append count bytes from data to the writer.
+///
+/// When the data fits, we copy it into the buffer and flush only once the
+/// threshold is reached. Otherwise, we send the buffered data and the new
+/// data together with a single writev.
+///
+/// We return MINIMK_EINVAL when count is zero.
+minimk_error_t minimk_bufwriter_write(minimk_bufwriter_t *writer, const void *data,
+                                      size_t count) MINIMK_NOEXCEPT;
+
+/// Send all the buffered data, suspending the current coroutine as needed.
+///
+/// On failure, we discard the buffered data, since we cannot know how much
+/// of it reached the peer and the connection is not usable anymore.
+minimk_error_t minimk_bufwriter_flush(minimk_bufwriter_t *writer) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_BUFWRITER_H
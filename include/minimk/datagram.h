@@ -0,0 +1,47 @@
+// File: include/minimk/datagram.h
+// Purpose: datagrams for batched I/O
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_DATAGRAM_H
+#define MINIMK_DATAGRAM_H
+
+#include <minimk/cdefs.h>    // for MINIMK_BEGIN_DECLS
+#include <minimk/iovec.h>    // for minimk_iovec_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+
+#include <stddef.h> // for size_t
+
+/// Maximum number of datagrams we move using a single batched system call.
+#define MINIMK_DATAGRAM_BATCH_MAX 64
+
+/// Datagram descriptor for batched send and receive operations.
+typedef struct minimk_datagram {
+    /// Peer address: destination when sending, source when receiving.
+    minimk_sockaddr_t addr;
+
+    /// Buffer containing the datagram or receiving it.
+    void *data;
+
+    /// Size of the buffer in bytes.
+    size_t count;
+
+    /// Number of bytes actually sent or received.
+    size_t length;
+} minimk_datagram_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Function to split a buffer coalesced by UDP_GRO into per-datagram views.
+///
+/// The data and nread arguments describe the received buffer and segment_size is
+/// the size of each datagram, except possibly the last, which may be shorter.
+///
+/// The views argument points to an array of count entries, which we set to point
+/// to the datagrams inside data without copying them.
+///
+/// Returns the number of views we set, which is at most count.
+size_t minimk_datagram_segments(void *data, size_t nread, size_t segment_size, minimk_iovec_t *views,
+                                size_t count) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_DATAGRAM_H
@@ -7,6 +7,7 @@
 #include <minimk/assert.h> // for MINIMK_ASSERT
 #include <minimk/cdefs.h>  // for MINIMK_UNSAFE_BUFFER_USAGE_*
 #include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iovec.h>  // for minimk_iovec_t
 
 #include <stddef.h> // for size_t
 
@@ -49,6 +50,62 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_io_writeall(T sock, const void *vbuf,
     return 0;
 }
 
+/// Write all the data contained in the given array of buffers.
+///
+/// This function automatically resumes sending when interrupted by a signal.
+///
+/// We advance the iov array in place across partial writes, so its content
+/// is unspecified when this function returns and you should not reuse it.
+///
+/// M_T_sendv must return MINIMK_EINVAL when the buffers contain zero bytes.
+///
+/// M_T_sendv must return nwritten > 0 when its return code is zero.
+template <typename T, minimk_error_t (*M_T_sendv)(T, const minimk_iovec_t *, size_t, size_t *)>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_io_writeallv(T sock, minimk_iovec_t *iov, size_t iovcnt) noexcept {
+    for (;;) {
+        // Skip the buffers we have completely written as well as empty buffers
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        while (iovcnt > 0 && iov[0].len <= 0) {
+            iov++;
+            iovcnt--;
+        }
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        if (iovcnt <= 0) {
+            return 0;
+        }
+
+        // Prepare for this round of doing I/O
+        size_t nwritten = 0;
+        minimk_error_t rv = M_T_sendv(sock, iov, iovcnt, &nwritten);
+
+        // Handle the failure cases
+        if (rv == MINIMK_EINTR) {
+            continue;
+        }
+        if (rv != 0) {
+            return rv; // all-or-nothing semantics
+        }
+
+        // Enforce documented assumptions on writing
+        MINIMK_ASSERT(nwritten > 0);
+        MINIMK_ASSERT(nwritten <= minimk_iovec_total(iov, iovcnt));
+
+        // Consume the written bytes, possibly leaving a partially written buffer first
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        while (nwritten > 0) {
+            size_t amount = (nwritten < iov[0].len) ? nwritten : iov[0].len;
+            iov[0].base = static_cast<char *>(iov[0].base) + amount;
+            iov[0].len -= amount;
+            nwritten -= amount;
+            if (iov[0].len <= 0) {
+                iov++;
+                iovcnt--;
+            }
+        }
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+    }
+}
+
 /// Read as much data as possible into the given buffer.
 ///
 /// This function automatically resumes receiving when interrupted by a signal.
@@ -0,0 +1,121 @@
+// File: include/minimk/iobuf.h
+// Purpose: reference-counted buffer chains for zero-copy protocol layering
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_IOBUF_H
+#define MINIMK_IOBUF_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/iovec.h> // for minimk_iovec_t
+
+#include <stddef.h> // for size_t
+
+/// Size in bytes of each block backing the segments, including its header.
+#define MINIMK_IOBUF_BLOCK_SIZE 16384
+
+/// Bytes we leave free in front of the first block of an empty chain.
+///
+/// This is enough for the framing header of common protocols, such as
+/// TLS records, WebSocket messages, and HTTP/2 frames, which a layer can
+/// then add using minimk_iobuf_prepend without allocating.
+#define MINIMK_IOBUF_HEADROOM 64
+
+/// Reference-counted block of memory shared by segments (opaque).
+struct minimk_iobuf_block;
+
+/// Segment of an iobuf chain referencing a byte range inside a block.
+typedef struct minimk_iobuf_seg {
+    /// Next segment in the chain or NULL.
+    struct minimk_iobuf_seg *next;
+
+    /// Block containing the bytes, which we keep alive using its reference count.
+    struct minimk_iobuf_block *block;
+
+    /// First byte of the range.
+    char *data;
+
+    /// Number of bytes in the range.
+    size_t len;
+} minimk_iobuf_seg_t;
+
+/// Chain of segments holding a logical byte sequence.
+///
+/// Splitting a chain or appending a chain to another moves or shares
+/// segments without copying their bytes, so protocol layers can frame and
+/// deframe payloads as they pass through.
+///
+/// Blocks and segments come from process-wide pools that grow using memory
+/// mappings and recycle freed objects, so steady-state operation does not
+/// allocate. Like the rest of the runtime, these pools are not thread safe.
+///
+/// Initialize using minimk_iobuf_init and release using minimk_iobuf_clear.
+typedef struct minimk_iobuf {
+    /// First segment or NULL.
+    minimk_iobuf_seg_t *head;
+
+    /// Last segment or NULL.
+    minimk_iobuf_seg_t *tail;
+
+    /// Total number of bytes in the chain.
+    size_t len;
+
+    /// Number of segments in the chain.
+    size_t nsegs;
+} minimk_iobuf_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Initialize an empty chain.
+void minimk_iobuf_init(minimk_iobuf_t *buf) MINIMK_NOEXCEPT;
+
+/// Release all the segments of the chain, which becomes empty.
+void minimk_iobuf_clear(minimk_iobuf_t *buf) MINIMK_NOEXCEPT;
+
+/// Copy count bytes from data to the end of the chain.
+///
+/// We fill the free space of the last block when no other segment is
+/// using it, and allocate new blocks as needed.
+///
+/// We return MINIMK_EINVAL when count is zero and MINIMK_ENOMEM when we
+/// cannot allocate, in which case the chain may contain a prefix of data.
+minimk_error_t minimk_iobuf_append(minimk_iobuf_t *buf, const void *data, size_t count) MINIMK_NOEXCEPT;
+
+/// Move all the segments of src to the end of dst without copying.
+///
+/// On return, src is empty.
+void minimk_iobuf_append_chain(minimk_iobuf_t *dst, minimk_iobuf_t *src) MINIMK_NOEXCEPT;
+
+/// Copy count bytes from data to the beginning of the chain.
+///
+/// We use the headroom in front of the first segment when available and
+/// otherwise allocate a new block, filling it from its end, so that later
+/// prepends also find headroom.
+///
+/// We return MINIMK_EINVAL when count is zero or does not fit in a single
+/// block, and MINIMK_ENOMEM when we cannot allocate.
+minimk_error_t minimk_iobuf_prepend(minimk_iobuf_t *buf, const void *data, size_t count) MINIMK_NOEXCEPT;
+
+/// Move the first count bytes of buf to the end of front without copying.
+///
+/// When the split point falls inside a segment, both chains end up
+/// referencing the same block.
+///
+/// We return MINIMK_EINVAL when count exceeds the length of buf and
+/// MINIMK_ENOMEM when we cannot allocate, in which case front contains
+/// the bytes moved so far.
+minimk_error_t minimk_iobuf_split(minimk_iobuf_t *buf, size_t count, minimk_iobuf_t *front) MINIMK_NOEXCEPT;
+
+/// Discard the first count bytes of the chain.
+///
+/// We return MINIMK_EINVAL when count exceeds the length of buf.
+minimk_error_t minimk_iobuf_drop(minimk_iobuf_t *buf, size_t count) MINIMK_NOEXCEPT;
+
+/// Describe the first segments of the chain using an array of buffers.
+///
+/// We fill at most iovcnt entries of iov and return how many we filled, so
+/// the caller can pass the result to minimk_socket_sendv.
+size_t minimk_iobuf_export(const minimk_iobuf_t *buf, minimk_iovec_t *iov, size_t iovcnt) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_IOBUF_H
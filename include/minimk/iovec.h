@@ -0,0 +1,34 @@
+// File: include/minimk/iovec.h
+// Purpose: scatter/gather I/O vectors
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_IOVEC_H
+#define MINIMK_IOVEC_H
+
+#include <minimk/cdefs.h> // for MINIMK_NOEXCEPT, MINIMK_UNSAFE_BUFFER_USAGE_*
+
+#include <stddef.h> // for size_t
+
+/// Buffer descriptor for scatter/gather I/O.
+///
+/// On POSIX systems, this structure has the same layout as `struct iovec`,
+/// so we can pass arrays of it to the kernel without copying.
+typedef struct minimk_iovec {
+    /// Pointer to the beginning of the buffer.
+    void *base;
+
+    /// Number of bytes in the buffer.
+    size_t len;
+} minimk_iovec_t;
+
+/// Function returning the total number of bytes in an array of buffers.
+static inline size_t minimk_iovec_total(const minimk_iovec_t *iov, size_t iovcnt) MINIMK_NOEXCEPT {
+    size_t total = 0;
+    for (size_t idx = 0; idx < iovcnt; idx++) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        total += iov[idx].len;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+    }
+    return total;
+}
+
+#endif // MINIMK_IOVEC_H
@@ -0,0 +1,102 @@
+// File: include/minimk/ndt7.h
+// Purpose: ndt7 network performance test client
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_NDT7_H
+#define MINIMK_NDT7_H
+
+#include <minimk/cdefs.h>   // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_t
+
+#include <stdint.h> // for uint64_t
+
+/// WebSocket subprotocol spoken by ndt7 servers.
+#define MINIMK_NDT7_PROTOCOL "net.measurementlab.ndt.v7"
+
+/// Default path of the download test.
+#define MINIMK_NDT7_DOWNLOAD_PATH "/ndt/v7/download"
+
+/// Default path of the upload test.
+#define MINIMK_NDT7_UPLOAD_PATH "/ndt/v7/upload"
+
+/// Default test duration in nanoseconds.
+#define MINIMK_NDT7_DEFAULT_DURATION 10000000000ULL
+
+/// Default interval between measurements in nanoseconds.
+#define MINIMK_NDT7_DEFAULT_INTERVAL 250000000ULL
+
+/// Application-level measurement taken during a test.
+typedef struct minimk_ndt7_measurement {
+    /// Microseconds elapsed since the beginning of the test.
+    uint64_t elapsed;
+
+    /// Number of message payload bytes transferred so far.
+    uint64_t num_bytes;
+
+    /// Kernel statistics of the connection, zero when unavailable.
+    minimk_tcpinfo_t tcpinfo;
+} minimk_ndt7_measurement_t;
+
+/// Configuration shared by the download and upload tests.
+typedef struct minimk_ndt7_config {
+    /// Numeric IPv4 or IPv6 address of the server (e.g., "127.0.0.1").
+    const char *address;
+
+    /// Port of the server in string form (e.g., "443").
+    const char *port;
+
+    /// Value of the Host header we send during the handshake.
+    const char *host;
+
+    /// Test duration in nanoseconds or zero for MINIMK_NDT7_DEFAULT_DURATION.
+    uint64_t duration;
+
+    /// Measurement interval in nanoseconds or zero for MINIMK_NDT7_DEFAULT_INTERVAL.
+    uint64_t interval;
+
+    /// Optional function we call with each measurement or NULL.
+    void (*callback)(void *opaque, const minimk_ndt7_measurement_t *measurement);
+
+    /// Opaque pointer passed to callback.
+    void *opaque;
+} minimk_ndt7_config_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Run the ndt7 download test against the server in config.
+///
+/// We perform the WebSocket upgrade and then consume the messages the server
+/// sends straight out of a large receive ring, without copying or masking
+/// their payloads. The test ends when the server closes the connection, and
+/// we close it ourselves if that does not happen within 1.5x the duration.
+/// Like in the upload, a server closing the TCP connection without sending a
+/// WebSocket close frame still ends the test successfully.
+///
+/// Every interval, we send an AppInfo measurement to the server and pass it
+/// to the callback. On success, result contains the final measurement.
+///
+/// This function must be called by a running coroutine. We allocate all the
+/// buffers before the test starts and never allocate per message.
+minimk_error_t minimk_ndt7_download(const minimk_ndt7_config_t *config, const char *path,
+                                    minimk_ndt7_measurement_t *result) MINIMK_NOEXCEPT;
+
+/// Run the ndt7 upload test against the server in config.
+///
+/// We send binary messages from a preallocated random buffer, starting at
+/// 8 KiB and doubling the message size whenever it is smaller than 1/16 of
+/// the bytes sent so far, up to 16 MiB, as the ndt7 specification suggests.
+/// After the duration, we close the connection and wait for the server to
+/// confirm. A server closing the TCP connection without sending a WebSocket
+/// close frame still ends the test successfully.
+///
+/// Every interval, we send an AppInfo measurement to the server and pass it
+/// to the callback. On success, result contains the final measurement.
+///
+/// This function must be called by a running coroutine. We allocate all the
+/// buffers before the test starts and never allocate per message.
+minimk_error_t minimk_ndt7_upload(const minimk_ndt7_config_t *config, const char *path,
+                                  minimk_ndt7_measurement_t *result) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_NDT7_H
@@ -0,0 +1,74 @@
+// File: include/minimk/ratelimit.h
+// Purpose: token-bucket rate limiter
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_RATELIMIT_H
+#define MINIMK_RATELIMIT_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+/// Minimum number of tokens stream sockets wait for, unless they want fewer or the burst is smaller.
+///
+/// Granting tokens as soon as a few trickle in would shape the throughput using
+/// tiny system calls, so we wait until we can transfer at least this many bytes.
+#define MINIMK_RATELIMIT_QUANTUM 4096
+
+/// Token-bucket rate limiter where each token allows transferring one byte.
+///
+/// The bucket fills at rate tokens per second up to burst tokens. Several
+/// sockets may share the same limiter to shape their aggregate throughput.
+///
+/// Initialize using minimk_ratelimit_init.
+typedef struct minimk_ratelimit {
+    /// Refill rate in bytes per second.
+    uint64_t rate;
+
+    /// Maximum number of tokens in the bucket.
+    uint64_t burst;
+
+    /// Number of tokens currently in the bucket.
+    uint64_t tokens;
+
+    /// Monotonic time in nanoseconds up to which we have accounted refills.
+    uint64_t last;
+} minimk_ratelimit_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Initialize a limiter allowing rate bytes per second with bursts of burst bytes.
+///
+/// The bucket starts full. Choose a burst at least as large as the largest
+/// datagram you intend to send, since datagrams cannot be split.
+///
+/// We return MINIMK_EINVAL when rate or burst is zero or when rate exceeds
+/// the 2^64 / 10^9 bytes per second our arithmetic supports.
+minimk_error_t minimk_ratelimit_init(minimk_ratelimit_t *limit, uint64_t rate,
+                                     uint64_t burst) MINIMK_NOEXCEPT;
+
+/// Take up to want tokens and at least atleast tokens from the bucket.
+///
+/// When fewer than atleast tokens are available, we suspend the running
+/// coroutine on the timer until the bucket refills enough, instead of
+/// polling. On success, granted contains the number of tokens taken.
+///
+/// This function must be called by a running coroutine.
+///
+/// We return MINIMK_EINVAL when atleast is zero, exceeds want, or exceeds
+/// the burst, since the bucket could then never satisfy the request.
+minimk_error_t minimk_ratelimit_acquire(minimk_ratelimit_t *limit, size_t want, size_t atleast,
+                                        size_t *granted) MINIMK_NOEXCEPT;
+
+/// Return the atleast argument of minimk_ratelimit_acquire for a stream transfer of want bytes.
+///
+/// This is the smallest of want, the burst, and MINIMK_RATELIMIT_QUANTUM.
+size_t minimk_ratelimit_quantum(const minimk_ratelimit_t *limit, size_t want) MINIMK_NOEXCEPT;
+
+/// Return unused tokens to the bucket, e.g., after a short write.
+void minimk_ratelimit_refund(minimk_ratelimit_t *limit, size_t count) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_RATELIMIT_H
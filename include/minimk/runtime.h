@@ -8,8 +8,56 @@
 #include <minimk/errno.h>   // for minimk_error_t
 #include <minimk/syscall.h> // for minimk_syscall_socket_t
 
+#include <stddef.h> // for size_t
 #include <stdint.h> // for uint64_t
 
+// Forward declaration of the coroutine.
+struct coroutine;
+
+/// Intrusive FIFO list of suspended coroutines.
+///
+/// The list is linked through the coroutine prev and next fields, which
+/// is possible because a coroutine is suspended on at most one list.
+///
+/// The fields are private to the runtime.
+struct minimk_runtime_waitlist {
+    /// First coroutine in the list or NULL.
+    struct coroutine *head;
+
+    /// Last coroutine in the list or NULL.
+    struct coroutine *tail;
+};
+
+/// Cooperative mutex for coroutines.
+///
+/// Zero initialize the mutex before using it. The fields are private to the runtime.
+struct minimk_runtime_mutex {
+    /// Coroutines waiting to acquire the mutex.
+    struct minimk_runtime_waitlist waiters;
+
+    /// Coroutine owning the mutex or NULL.
+    struct coroutine *owner;
+};
+
+/// Cooperative counting semaphore for coroutines.
+///
+/// Use minimk_runtime_semaphore_init to initialize. The fields are private to the runtime.
+struct minimk_runtime_semaphore {
+    /// Coroutines waiting for a permit.
+    struct minimk_runtime_waitlist waiters;
+
+    /// Number of available permits.
+    uint64_t count;
+};
+
+/// Cooperative condition variable for coroutines.
+///
+/// Zero initialize the condition before using it. The fields are private to the runtime.
+struct minimk_runtime_cond {
+    /// Coroutines waiting for the condition to be signalled.
+    struct minimk_runtime_waitlist waiters;
+};
+
 MINIMK_BEGIN_DECLS
 
 /// Creates a coroutine that the runtime will execute.
@@ -54,6 +102,99 @@ minimk_error_t minimk_runtime_suspend_read(minimk_syscall_socket_t sock, uint64_
 /// Like minimk_runtime_suspend_read but for writability.
 minimk_error_t minimk_runtime_suspend_write(minimk_syscall_socket_t sock, uint64_t nanosec) MINIMK_NOEXCEPT;
 
+/// Like minimk_runtime_suspend_read but for pending socket errors.
+///
+/// This is how to wait for notifications queued on the socket error queue,
+/// such as MSG_ZEROCOPY completions, without waking up on readability or
+/// writability. The caller should drain the error queue once resumed.
+minimk_error_t minimk_runtime_suspend_error(minimk_syscall_socket_t sock, uint64_t nanosec) MINIMK_NOEXCEPT;
+
+/// Suspends the coroutine until the given signal is delivered to the process.
+///
+/// The first time a coroutine waits for a signal, the runtime blocks the signal
+/// using sigprocmask and creates a signalfd for receiving it, which the scheduler
+/// then polls like any other descriptor. From that moment on, the signal is never
+/// delivered through signal handlers. Call this function before creating threads,
+/// or block the signal in all threads, to avoid the signal being delivered to a
+/// thread that has not blocked it.
+///
+/// When several coroutines wait for the same signal, each delivery wakes up one
+/// of them. A signal delivered while no coroutine is waiting remains pending and
+/// is consumed by the next wait.
+///
+/// This function is Linux specific and must be called by a running coroutine.
+///
+/// Returns zero once the signal has been received, MINIMK_EINVAL if the signal
+/// number is invalid or names SIGKILL or SIGSTOP, which cannot be blocked, or
+/// another nonzero error code on failure.
+minimk_error_t minimk_runtime_signal_wait(int signo) MINIMK_NOEXCEPT;
+
+/// Allocates a new coroutine-local storage key.
+///
+/// Each coroutine has its own value for each key, initially NULL. When a coroutine
+/// exits, the runtime invokes the destructor, if not NULL, on each non-NULL value
+/// before releasing the coroutine. The destructor runs outside of the coroutine
+/// and therefore must not call functions that suspend the coroutine.
+///
+/// Keys are a scarce resource and cannot be released, so allocate them once
+/// during initialization, e.g., before calling minimk_runtime_run.
+///
+/// Returns zero on success and MINIMK_EAGAIN when there are no more keys.
+minimk_error_t minimk_runtime_local_key_create(size_t *key, void (*destructor)(void *value)) MINIMK_NOEXCEPT;
+
+/// Sets the running coroutine value for the given key.
+///
+/// This function must be called by a running coroutine.
+///
+/// Returns zero on success and MINIMK_EINVAL if the key has not been allocated.
+minimk_error_t minimk_runtime_local_set(size_t key, void *value) MINIMK_NOEXCEPT;
+
+/// Returns the running coroutine value for the given key or NULL.
+///
+/// This function must be called by a running coroutine.
+void *minimk_runtime_local_get(size_t key) MINIMK_NOEXCEPT;
+
+/// Acquires the mutex, suspending the coroutine while another coroutine owns it.
+///
+/// Waiters acquire the mutex in FIFO order because unlock directly transfers the
+/// ownership to the first waiter. The mutex is not recursive.
+///
+/// This function must be called by a running coroutine.
+void minimk_runtime_mutex_lock(struct minimk_runtime_mutex *mutex) MINIMK_NOEXCEPT;
+
+/// Releases the mutex owned by the running coroutine and wakes up the first waiter.
+///
+/// This function must be called by a running coroutine.
+void minimk_runtime_mutex_unlock(struct minimk_runtime_mutex *mutex) MINIMK_NOEXCEPT;
+
+/// Initializes the semaphore with the given number of permits.
+void minimk_runtime_semaphore_init(struct minimk_runtime_semaphore *sema, uint64_t count) MINIMK_NOEXCEPT;
+
+/// Acquires a permit, suspending the coroutine while none are available.
+///
+/// This function must be called by a running coroutine.
+void minimk_runtime_semaphore_wait(struct minimk_runtime_semaphore *sema) MINIMK_NOEXCEPT;
+
+/// Releases a permit, which is transferred to the first waiter, if any.
+///
+/// This function must be called by a running coroutine.
+void minimk_runtime_semaphore_post(struct minimk_runtime_semaphore *sema) MINIMK_NOEXCEPT;
+
+/// Atomically releases the mutex and suspends until the condition is signalled,
+/// then acquires the mutex again before returning.
+///
+/// Like with pthread, the caller should recheck its predicate in a loop.
+///
+/// This function must be called by a running coroutine owning the mutex.
+void minimk_runtime_cond_wait(struct minimk_runtime_cond *cond,
+                              struct minimk_runtime_mutex *mutex) MINIMK_NOEXCEPT;
+
+/// Wakes up the first coroutine waiting on the condition, if any.
+void minimk_runtime_cond_signal(struct minimk_runtime_cond *cond) MINIMK_NOEXCEPT;
+
+/// Wakes up all the coroutines waiting on the condition.
+void minimk_runtime_cond_broadcast(struct minimk_runtime_cond *cond) MINIMK_NOEXCEPT;
+
 MINIMK_END_DECLS
 
 #endif // MINIMK_RUNTIME_H
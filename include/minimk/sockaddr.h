@@ -0,0 +1,49 @@
+// File: include/minimk/sockaddr.h
+// Purpose: pre-resolved socket addresses
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_SOCKADDR_H
+#define MINIMK_SOCKADDR_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stdint.h> // for uint64_t
+
+/// Pre-resolved IPv4 or IPv6 socket address and port.
+///
+/// This is a value type that you can freely copy. Parse it once using
+/// minimk_sockaddr_parse and then pass it to minimk_socket_connect_addr
+/// or minimk_socket_bind_addr as many times as needed.
+typedef struct minimk_sockaddr {
+    /// Storage for the platform sockaddr_in or sockaddr_in6 (private).
+    uint64_t storage[4];
+
+    /// Length of the platform address within storage (private).
+    uint32_t length;
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+} minimk_sockaddr_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Function to parse a numeric address and port into a minimk_sockaddr_t.
+///
+/// This function is thread-safe and does not allocate memory.
+///
+/// The sa return argument is zeroed when the function is invoked and
+/// contains the parsed address on success.
+///
+/// The address MUST be an IPv4 or IPv6 address in string form (e.g., "127.0.0.1", "::1").
+/// IPv6 addresses may carry a scope, either an interface name or index, after
+/// a percent sign (e.g., "fe80::1%eth0").
+///
+/// The port MUST be a port number in string form (e.g., "8080").
+///
+/// The return value is zero on success and MINIMK_EINVAL on failure.
+minimk_error_t minimk_sockaddr_parse(minimk_sockaddr_t *sa, const char *address,
+                                     const char *port) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_SOCKADDR_H
@@ -4,8 +4,16 @@
 #ifndef MINIMK_SOCKET_H
 #define MINIMK_SOCKET_H
 
-#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
-#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/cdefs.h>     // for MINIMK_BEGIN_DECLS
+#include <minimk/datagram.h>  // for minimk_datagram_t
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iobuf.h>     // for minimk_iobuf_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/sockaddr.h>  // for minimk_sockaddr_t
+#include <minimk/sockopt.h>   // for minimk_sockopt_t
+#include <minimk/syscall.h>   // for minimk_syscall_socket_t
+#include <minimk/tcpinfo.h>   // for minimk_tcpinfo_t
 
 #include <stddef.h> // for size_t
 #include <stdint.h> // for uint64_t
@@ -16,6 +24,29 @@ typedef uint64_t minimk_socket_t;
 /// Canonical invalid socket handle.
 #define MINIMK_SOCKET_INVALID 0
 
+/// Periodic sampler of the TCP_INFO of several sockets.
+///
+/// Use minimk_runtime_go(minimk_socket_tcpinfo_sampler_run, &sampler) to start it.
+typedef struct minimk_socket_tcpinfo_sampler {
+    /// Array of count sockets to sample.
+    const minimk_socket_t *socks;
+
+    /// Array of count rings, where rings[i] receives the samples of socks[i].
+    minimk_tcpinfo_ring_t *rings;
+
+    /// Number of entries in socks and rings.
+    size_t count;
+
+    /// Nanoseconds between samples (e.g., 250 ms).
+    uint64_t interval;
+
+    /// Set to nonzero to stop the sampler at its next wakeup.
+    uint32_t stop;
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+} minimk_socket_tcpinfo_sampler_t;
+
 MINIMK_BEGIN_DECLS
 
 /// Function to create a new socket instance.
@@ -26,9 +57,9 @@ MINIMK_BEGIN_DECLS
 /// The socket structure will refer to a valid socket and its timeouts will
 /// be set to UINT64_MAX, which is basically equal to infinite.
 ///
-/// The underlying socket is configured as nonblocking and for SIGPIPE
-/// prevention: SO_NOSIGPIPE is set when available (FreeBSD/macOS). See
-/// minimk_socket_send docs for more details on SIGPIPE.
+/// The underlying socket is configured as nonblocking, as close-on-exec where
+/// available (Linux), and for SIGPIPE prevention: SO_NOSIGPIPE is set when
+/// available (FreeBSD/macOS). See minimk_socket_send docs for more details on SIGPIPE.
 ///
 /// On success, you take ownership of the heap allocated socket.
 ///
@@ -52,6 +83,27 @@ minimk_error_t minimk_socket_set_read_timeout(minimk_socket_t sock, uint64_t nan
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_socket_set_write_timeout(minimk_socket_t sock, uint64_t nanosec) MINIMK_NOEXCEPT;
 
+/// Function to shape the data sent using minimk_socket_send and minimk_socket_sendto.
+///
+/// Before sending, we take tokens from the limiter, suspending the coroutine on
+/// the timer until they are available, and send at most as many bytes as tokens.
+/// A stream send waits for at least MINIMK_RATELIMIT_QUANTUM tokens, or fewer if
+/// the send or the burst is smaller, to avoid tiny system calls. A datagram needs
+/// tokens for its whole size. Unused tokens return to the limiter.
+///
+/// The limit argument must outlive the socket and may be shared by several
+/// sockets. Pass NULL to stop shaping.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_set_send_ratelimit(minimk_socket_t sock,
+                                                minimk_ratelimit_t *limit) MINIMK_NOEXCEPT;
+
+/// Like minimk_socket_set_send_ratelimit but for minimk_socket_recv.
+///
+/// Reading more slowly lets the kernel receive window throttle the peer.
+minimk_error_t minimk_socket_set_recv_ratelimit(minimk_socket_t sock,
+                                                minimk_ratelimit_t *limit) MINIMK_NOEXCEPT;
+
 /// Function to bind a socket to a local address and port.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create.
@@ -66,6 +118,13 @@ minimk_error_t minimk_socket_set_write_timeout(minimk_socket_t sock, uint64_t na
 minimk_error_t minimk_socket_bind(minimk_socket_t sock, const char *address,
                                   const char *port) MINIMK_NOEXCEPT;
 
+/// Like minimk_socket_bind but using an address parsed with minimk_sockaddr_parse.
+///
+/// Since the address is already parsed, this function only issues the system call.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_bind_addr(minimk_socket_t sock, const minimk_sockaddr_t *sa) MINIMK_NOEXCEPT;
+
 /// Function to mark a socket as listening for incoming connections.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create
@@ -77,13 +136,37 @@ minimk_error_t minimk_socket_bind(minimk_socket_t sock, const char *address,
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_socket_listen(minimk_socket_t sock, int backlog) MINIMK_NOEXCEPT;
 
+/// Reads the kernel TCP_INFO statistics of the given stream socket.
+///
+/// The info argument is zeroed when the function is called and updated on success,
+/// including its time field, which we set to the current monotonic time.
+///
+/// This function never suspends and is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_get_tcpinfo(minimk_socket_t sock, minimk_tcpinfo_t *info) MINIMK_NOEXCEPT;
+
+/// Coroutine entry that periodically samples TCP_INFO into the sampler rings.
+///
+/// The opaque argument must point to a minimk_socket_tcpinfo_sampler_t that remains
+/// valid until the coroutine exits.
+///
+/// Each tick costs one getsockopt per valid socket and performs no allocation, so a
+/// single coroutine can sample thousands of flows. Ticks follow a fixed schedule and
+/// we skip the ticks we miss, so slow ticks do not cause drift.
+///
+/// The coroutine exits when stop is nonzero or when no socket remains valid, so you
+/// can destroy the sockets before stopping the sampler.
+void minimk_socket_tcpinfo_sampler_run(void *opaque) MINIMK_NOEXCEPT;
+
 /// Function to accept an incoming connection on a listening socket.
 ///
 /// The client_sock return argument will be set to MINIMK_INVALID_HANDLE when the
 /// function is invoked and later changed to a valid socket on success representing the
 /// accepted client connection. The underlying client_sock socket will be configured for
-/// using nonblocking I/O and for SIGPIPE prevention, using SO_NOSIGPIPE where
-/// available (macOS/FreeBSD). See minimk_socket_send docs for more details on SIGPIPE.
+/// using nonblocking I/O, as close-on-exec where available (Linux), and for SIGPIPE
+/// prevention, using SO_NOSIGPIPE where available (macOS/FreeBSD). See minimk_socket_send
+/// docs for more details on SIGPIPE.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create,
 /// bound using minimk_socket_bind, and marked as listening using
@@ -94,6 +177,29 @@ minimk_error_t minimk_socket_listen(minimk_socket_t sock, int backlog) MINIMK_NO
 /// We return MINIMK_ETIMEDOUT when the sock read_timeout expires.
 minimk_error_t minimk_socket_accept(minimk_socket_t *client_sock, minimk_socket_t sock) MINIMK_NOEXCEPT;
 
+/// Like minimk_socket_accept but accepts up to count connections at once.
+///
+/// The client_socks return argument must point to an array of count handles, which
+/// are all set to MINIMK_INVALID_HANDLE when the function is invoked. On success,
+/// the first naccepted handles are valid sockets configured like the ones returned
+/// by minimk_socket_accept.
+///
+/// The count argument is the size of the client_socks array and must be positive.
+///
+/// The naccepted return argument is set to zero when the function is invoked and
+/// then to the number of accepted connections, which on success is positive.
+///
+/// The function suspends until there is at least one pending connection and then
+/// drains the listener backlog without suspending again. An error occurring after
+/// accepting at least a connection stops the batch, is not reported, and the next
+/// call will most likely report it again.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+///
+/// We return MINIMK_ETIMEDOUT when the sock read_timeout expires.
+minimk_error_t minimk_socket_accept_many(minimk_socket_t *client_socks, size_t count, size_t *naccepted,
+                                         minimk_socket_t sock) MINIMK_NOEXCEPT;
+
 /// Function to establish a connection with a remote endpoint.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create.
@@ -113,6 +219,15 @@ minimk_error_t minimk_socket_accept(minimk_socket_t *client_sock, minimk_socket_
 minimk_error_t minimk_socket_connect(minimk_socket_t sock, const char *address,
                                      const char *port) MINIMK_NOEXCEPT;
 
+/// Like minimk_socket_connect but using an address parsed with minimk_sockaddr_parse.
+///
+/// Use this function to avoid parsing the same address each time you connect to it.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+///
+/// We return MINIMK_ETIMEDOUT when the sock write_timeout expires.
+minimk_error_t minimk_socket_connect_addr(minimk_socket_t sock, const minimk_sockaddr_t *sa) MINIMK_NOEXCEPT;
+
 /// Function to read bytes from a given socket.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create.
@@ -140,6 +255,65 @@ minimk_error_t minimk_socket_recv(minimk_socket_t sock, void *data, size_t count
 /// Like minimk_socket_sendall but for receiving.
 minimk_error_t minimk_socket_recvall(minimk_socket_t sock, void *buf, size_t count) MINIMK_NOEXCEPT;
 
+/// Function to receive a datagram along with its source address.
+///
+/// The sock argument must be a valid datagram socket created using minimk_socket_create.
+///
+/// The data argument must be a valid array for receiving the datagram and the count
+/// argument must be its size. Excess bytes of a larger datagram are discarded.
+///
+/// The sa argument is zeroed when the function is called and contains the source
+/// address on success. You can pass it to minimk_socket_sendto to reply.
+///
+/// The nread argument is set to zero when the function is called and updated
+/// to be the number of bytes read on success. Since zero-length datagrams are
+/// valid, we never return MINIMK_EOF.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+///
+/// We return MINIMK_ETIMEDOUT when the sock read_timeout expires.
+minimk_error_t minimk_socket_recvfrom(minimk_socket_t sock, void *data, size_t count, minimk_sockaddr_t *sa,
+                                      size_t *nread) MINIMK_NOEXCEPT;
+
+/// Function to receive a batch of datagrams with a single system call.
+///
+/// The sock argument must be a valid datagram socket created using minimk_socket_create.
+///
+/// The dgrams argument points to an array of count datagrams, whose data and count fields
+/// must describe valid nonempty buffers. On success, we set the addr and length fields of
+/// the first nrecv datagrams.
+///
+/// We suspend until at least one datagram is available and then receive as many pending
+/// datagrams as possible, up to count and MINIMK_DATAGRAM_BATCH_MAX.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+///
+/// We return MINIMK_ETIMEDOUT when the sock read_timeout expires.
+minimk_error_t minimk_socket_recvfrom_many(minimk_socket_t sock, minimk_datagram_t *dgrams, size_t count,
+                                           size_t *nrecv) MINIMK_NOEXCEPT;
+
+/// Like minimk_socket_recvfrom but also returns the UDP_GRO segment size.
+///
+/// When you enable minimk_socket_setsockopt_udp_gro, the kernel may coalesce several
+/// datagrams from the same source into data. The segment_size argument is then set to
+/// the size of each datagram, except possibly the last. Otherwise, it equals nread.
+///
+/// Use minimk_datagram_segments to split data into per-datagram views.
+///
+/// This function is only available on Linux.
+minimk_error_t minimk_socket_recvfrom_gro(minimk_socket_t sock, void *data, size_t count,
+                                          minimk_sockaddr_t *sa, size_t *segment_size,
+                                          size_t *nread) MINIMK_NOEXCEPT;
+
+/// Like minimk_socket_recv but scatters the data into an array of buffers.
+///
+/// The iov argument points to an array of iovcnt buffers, which we fill in order
+/// using a single system call.
+///
+/// We return MINIMK_EINVAL when the buffers contain zero bytes.
+minimk_error_t minimk_socket_recvv(minimk_socket_t sock, minimk_iovec_t *iov, size_t iovcnt,
+                                   size_t *nread) MINIMK_NOEXCEPT;
+
 /// Function to write bytes to a given socket.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create.
@@ -175,6 +349,199 @@ minimk_error_t minimk_socket_send(minimk_socket_t sock, const void *data, size_t
 /// When interruped by MINIMK_EINTR, this function continues to write relentlessly.
 minimk_error_t minimk_socket_sendall(minimk_socket_t sock, const void *buf, size_t count) MINIMK_NOEXCEPT;
 
+/// Like minimk_socket_send but uses MSG_ZEROCOPY to avoid copying data into the kernel.
+///
+/// You must enable minimk_socket_setsockopt_zerocopy first, otherwise we return
+/// MINIMK_EINVAL. This function is only available on Linux.
+///
+/// On success, the id return argument is set to the completion ID of this send and the
+/// caller MUST NOT modify or free data until minimk_socket_zerocopy_wait returns zero for
+/// this ID (or a later one). Pending completions are delivered via POLLERR, so you should
+/// wait for them promptly: while they are queued and no coroutine is blocked in
+/// minimk_socket_zerocopy_wait, coroutines blocked in read or write operations on the
+/// same socket also wake up and retry.
+///
+/// Zero-copy only pays off for large writes (tens of KiB or more), since pinning pages
+/// and reaping completions also has a cost. When the kernel cannot avoid copying (e.g.,
+/// over loopback), it still posts completions, so the protocol is unchanged.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_ENOBUFS when too many completions are pending, in which case you should wait
+/// for the oldest ones before sending again.
+///
+/// We return MINIMK_ETIMEDOUT when the sock write_timeout expires.
+minimk_error_t minimk_socket_send_zerocopy(minimk_socket_t sock, const void *data, size_t count,
+                                           size_t *nwritten, uint32_t *id) MINIMK_NOEXCEPT;
+
+/// Suspends until the buffer passed to the minimk_socket_send_zerocopy with the given ID is reusable.
+///
+/// We read the completions from the socket error queue and, since TCP completes sends in
+/// order, completing an ID also completes all the previous ones.
+///
+/// The return value is zero on success or a nonzero error code on failure. When we
+/// wake up without new completions, we return the pending socket error, if any, or
+/// MINIMK_ECONNRESET if the peer hung up, since no more completions can arrive.
+///
+/// We return MINIMK_ETIMEDOUT when the sock write_timeout expires.
+minimk_error_t minimk_socket_zerocopy_wait(minimk_socket_t sock, uint32_t id) MINIMK_NOEXCEPT;
+
+/// Sends file content to a socket without copying it through user space.
+///
+/// The fd argument must be a file descriptor supporting mmap, such as a regular file.
+///
+/// The offset argument is the file position where to start reading. We do not change
+/// the file position of fd, so you must advance offset by nwritten before the next call.
+///
+/// The nwritten argument is set to zero when the function is called and updated
+/// to be the number of bytes written on success, which may be less than count.
+///
+/// We suspend while the socket is not writable. Reading from the file may still block
+/// the whole runtime on disk I/O if the file content is not in the page cache.
+///
+/// This function is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_EOF when offset is at or past the end of file.
+///
+/// We return MINIMK_ETIMEDOUT when the sock write_timeout expires.
+minimk_error_t minimk_socket_sendfile(minimk_socket_t sock, minimk_syscall_socket_t fd, uint64_t offset,
+                                      size_t count, size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Moves data from a pipe to a socket without copying it through user space.
+///
+/// The pipefd argument must be the read end of a pipe and this coroutine must be its
+/// only reader. We never block on it, regardless of whether it is nonblocking.
+///
+/// The nwritten argument is set to zero when the function is called and updated
+/// to be the number of bytes written on success, which may be less than count.
+///
+/// We suspend while the pipe is empty, using the sock read_timeout, and while the
+/// socket is not writable, using the sock write_timeout.
+///
+/// This function is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_EOF when the pipe is empty and has no writers.
+///
+/// We return MINIMK_ETIMEDOUT when either timeout expires.
+minimk_error_t minimk_socket_splice(minimk_socket_t sock, minimk_syscall_socket_t pipefd, size_t count,
+                                    size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Like minimk_socket_send but gathers the data from an array of buffers.
+///
+/// The iov argument points to an array of iovcnt buffers, which we send in order
+/// using a single system call. Use this function to send, e.g., a protocol header
+/// and its payload without copying them into a single buffer.
+///
+/// We return MINIMK_EINVAL when the buffers contain zero bytes.
+minimk_error_t minimk_socket_sendv(minimk_socket_t sock, const minimk_iovec_t *iov, size_t iovcnt,
+                                   size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Like minimk_socket_sendv but sends all the content of the buffers unless an error occurs.
+///
+/// We advance the iov array in place across partial writes, so its content
+/// is unspecified when this function returns and you should not reuse it.
+///
+/// In case of short write, returns error. This is an all-or-nothing operation.
+///
+/// When interruped by MINIMK_EINTR, this function continues to write relentlessly.
+minimk_error_t minimk_socket_sendallv(minimk_socket_t sock, minimk_iovec_t *iov,
+                                      size_t iovcnt) MINIMK_NOEXCEPT;
+
+/// Sends all the content of an iobuf chain, consuming it as the kernel accepts data.
+///
+/// We pass the chain segments to minimk_socket_sendv directly, so the payload
+/// is never copied. On success, the chain is empty. On failure, the chain
+/// contains the data that we did not send.
+///
+/// When interruped by MINIMK_EINTR, this function continues to write relentlessly.
+minimk_error_t minimk_socket_sendall_iobuf(minimk_socket_t sock, minimk_iobuf_t *buf) MINIMK_NOEXCEPT;
+
+/// Function to send a datagram to a given destination address.
+///
+/// The sock argument must be a valid datagram socket created using minimk_socket_create.
+///
+/// The data argument must be a valid array containing the datagram and the count
+/// argument must be its size. Like minimk_socket_send, we return MINIMK_EINVAL
+/// when count is zero.
+///
+/// The sa argument must be an address parsed using minimk_sockaddr_parse.
+///
+/// The nwritten argument is set to zero when the function is called and updated
+/// to be the number of bytes written on success.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+///
+/// We return MINIMK_ETIMEDOUT when the sock write_timeout expires.
+minimk_error_t minimk_socket_sendto(minimk_socket_t sock, const void *data, size_t count,
+                                    const minimk_sockaddr_t *sa, size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Function to send a batch of datagrams with a single system call.
+///
+/// The sock argument must be a valid datagram socket created using minimk_socket_create.
+///
+/// The dgrams argument points to an array of count datagrams, whose addr, data, and count
+/// fields must describe parsed addresses and valid nonempty buffers. On success, we set
+/// the length field of the first nsent datagrams.
+///
+/// We suspend until the socket is writable and then send as many datagrams as possible,
+/// up to count and MINIMK_DATAGRAM_BATCH_MAX. Call this function again to send the
+/// remaining datagrams.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+///
+/// We return MINIMK_ETIMEDOUT when the sock write_timeout expires.
+minimk_error_t minimk_socket_sendto_many(minimk_socket_t sock, minimk_datagram_t *dgrams, size_t count,
+                                         size_t *nsent) MINIMK_NOEXCEPT;
+
+/// Like minimk_socket_sendto but uses UDP generic segmentation offload (GSO).
+///
+/// The kernel splits data into datagrams of segment_size bytes, except possibly
+/// the last, so a single system call sends many equal-size datagrams. The kernel
+/// limits the number of segments (64 on Linux) and the count must not exceed the
+/// maximum UDP payload size.
+///
+/// This function is only available on Linux.
+minimk_error_t minimk_socket_sendto_gso(minimk_socket_t sock, const void *data, size_t count,
+                                        const minimk_sockaddr_t *sa, size_t segment_size,
+                                        size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Function to set the value of a typed socket option.
+///
+/// The option argument is one of the MINIMK_SOCKOPT_* identifiers.
+///
+/// Use this function to tune a connection, for example by disabling Nagle's algorithm
+/// for request-response protocols, or by capping the amount of unsent data with
+/// TCP_NOTSENT_LOWAT to reduce sender-side latency.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_EINVAL if the option is unknown or not supported on this system, or if the
+/// value does not fit into an int for options using an int value.
+minimk_error_t minimk_socket_setsockopt(minimk_socket_t sock, minimk_sockopt_t option,
+                                        uint64_t value) MINIMK_NOEXCEPT;
+
+/// Function to get the value of a typed socket option.
+///
+/// The option argument is one of the MINIMK_SOCKOPT_* identifiers.
+///
+/// The value argument is set to zero when the function is called and updated
+/// to be the option value on success.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_EINVAL if the option is unknown or not supported on this system.
+minimk_error_t minimk_socket_getsockopt(minimk_socket_t sock, minimk_sockopt_t option,
+                                        uint64_t *value) MINIMK_NOEXCEPT;
+
+/// Function to set the TCP_CONGESTION socket option.
+///
+/// The algorithm argument is the name of the congestion control algorithm (e.g., "bbr").
+///
+/// This function is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_setsockopt_congestion(minimk_socket_t sock,
+                                                   const char *algorithm) MINIMK_NOEXCEPT;
+
 /// Function to set SO_REUSEADDR socket option.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create.
@@ -186,6 +553,54 @@ minimk_error_t minimk_socket_sendall(minimk_socket_t sock, const void *buf, size
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_socket_setsockopt_reuseaddr(minimk_socket_t sock) MINIMK_NOEXCEPT;
 
+/// Function to steer the connections of a SO_REUSEPORT group to the listener of the current CPU.
+///
+/// The sock argument must be a bound listener with MINIMK_SOCKOPT_REUSEPORT enabled and
+/// the program applies to its whole group. The kernel selects the listener whose index in
+/// the group equals the CPU processing the incoming packet, where the index is the order
+/// in which listeners joined the group, and falls back to hashing when there is none.
+///
+/// The runtime uses a single scheduler per process, so to scale accept with the cores:
+///
+/// 1. create a listener per CPU ID below minimk_syscall_cpu_span, in CPU order, with
+/// MINIMK_SOCKOPT_REUSEPORT, including CPUs the process may not run on;
+///
+/// 2. attach the steering program to any of them;
+///
+/// 3. fork a worker per CPU, which uses minimk_syscall_cpu_pin and then only accepts
+/// on its own listener, closing the other ones.
+///
+/// This way, each worker accepts the connections whose packets its CPU processes,
+/// without contending on a single accept queue.
+///
+/// This function is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_setsockopt_reuseport_cbpf_cpu(minimk_socket_t sock) MINIMK_NOEXCEPT;
+
+/// Function to set the UDP_GRO socket option.
+///
+/// The sock argument must be a valid datagram socket created using minimk_socket_create.
+///
+/// This function allows the kernel to coalesce consecutive datagrams from the same
+/// source into a single buffer. Use minimk_socket_recvfrom_gro to receive them.
+///
+/// This function is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_setsockopt_udp_gro(minimk_socket_t sock) MINIMK_NOEXCEPT;
+
+/// Function to set the SO_ZEROCOPY socket option.
+///
+/// The sock argument must be a valid stream socket created using minimk_socket_create.
+///
+/// This function allows using minimk_socket_send_zerocopy.
+///
+/// This function is only available on Linux.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_socket_setsockopt_zerocopy(minimk_socket_t sock) MINIMK_NOEXCEPT;
+
 /// Function to destroy a socket instance.
 ///
 /// The sock argument must be a valid socket created using minimk_socket_create.
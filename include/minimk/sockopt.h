@@ -0,0 +1,48 @@
+// File: include/minimk/sockopt.h
+// Purpose: typed socket options for tuning connections
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_SOCKOPT_H
+#define MINIMK_SOCKOPT_H
+
+/// Type of the identifiers of the socket options we know how to set and get.
+///
+/// All these options carry an integer value. Options the running system does
+/// not support cause the corresponding functions to fail with MINIMK_EINVAL.
+typedef int minimk_sockopt_t;
+
+/// Boolean TCP_NODELAY option for disabling Nagle's algorithm.
+#define MINIMK_SOCKOPT_TCP_NODELAY 1
+
+/// Boolean TCP_CORK option for holding partial segments until uncorked (Linux).
+#define MINIMK_SOCKOPT_TCP_CORK 2
+
+/// SO_SNDBUF option for the send buffer size in bytes.
+///
+/// Note that Linux doubles the value to account for bookkeeping overhead and
+/// disables send buffer autotuning once set.
+#define MINIMK_SOCKOPT_SNDBUF 3
+
+/// SO_RCVBUF option for the receive buffer size in bytes.
+///
+/// Note that Linux doubles the value to account for bookkeeping overhead and
+/// disables receive buffer autotuning once set.
+#define MINIMK_SOCKOPT_RCVBUF 4
+
+/// TCP_NOTSENT_LOWAT option for the amount of unsent bytes below which the
+/// socket is writable, which bounds the sender-side queuing delay.
+#define MINIMK_SOCKOPT_TCP_NOTSENT_LOWAT 5
+
+/// SO_MAX_PACING_RATE option for the maximum pacing rate in bytes per second (Linux).
+#define MINIMK_SOCKOPT_MAX_PACING_RATE 6
+
+/// SO_BUSY_POLL option for the microseconds to busy poll the device queue
+/// on blocking receives when there is no data (Linux).
+#define MINIMK_SOCKOPT_BUSY_POLL 7
+
+/// Boolean SO_REUSEPORT option for binding several sockets to the same address
+/// and port, such that the kernel distributes the incoming connections among the
+/// listening sockets of the group. All the sockets in a group must set it before
+/// binding and belong to the same effective user.
+#define MINIMK_SOCKOPT_REUSEPORT 8
+
+#endif // MINIMK_SOCKOPT_H
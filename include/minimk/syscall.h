@@ -4,8 +4,13 @@
 #ifndef MINIMK_SYSCALL_H
 #define MINIMK_SYSCALL_H
 
-#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
-#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/cdefs.h>    // for MINIMK_BEGIN_DECLS
+#include <minimk/datagram.h> // for minimk_datagram_t
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/iovec.h>    // for minimk_iovec_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/sockopt.h>  // for minimk_sockopt_t
+#include <minimk/tcpinfo.h>  // for minimk_tcpinfo_t
 
 #include <stddef.h> // for size_t
 #include <stdint.h> // for uint64_t
@@ -48,6 +53,9 @@ extern short minimk_syscall_pollout;
 /// Variable containing the platform's POLLERR definition.
 extern short minimk_syscall_pollerr;
 
+/// Variable containing the platform's POLLHUP definition.
+extern short minimk_syscall_pollhup;
+
 /// Variable containing the SOCK_STREAM definition used by this platform.
 extern int minimk_syscall_sock_stream;
 
@@ -69,6 +77,18 @@ MINIMK_BEGIN_DECLS
 minimk_error_t minimk_syscall_accept(minimk_syscall_socket_t *client_sock,
                                      minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
 
+/// Like minimk_syscall_accept but the accepted socket is nonblocking and close-on-exec.
+///
+/// This function is thread-safe.
+///
+/// On Linux, we use a single accept4 system call with SOCK_NONBLOCK and SOCK_CLOEXEC.
+/// Elsewhere, we fall back to accept followed by minimk_syscall_socket_setnonblock,
+/// and the socket is not close-on-exec.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_accept_nonblock(minimk_syscall_socket_t *client_sock,
+                                              minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
+
 /// Function to bind a socket to a local address.
 ///
 /// This function is thread-safe.
@@ -79,10 +99,21 @@ minimk_error_t minimk_syscall_accept(minimk_syscall_socket_t *client_sock,
 ///
 /// The port MUST be a port number in string form.
 ///
+/// We parse the address using minimk_sockaddr_parse and then invoke
+/// minimk_syscall_bind_addr.
+///
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_syscall_bind(minimk_syscall_socket_t sock, const char *address,
                                    const char *port) MINIMK_NOEXCEPT;
 
+/// Like minimk_syscall_bind but using an address parsed with minimk_sockaddr_parse.
+///
+/// This function is thread-safe.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_bind_addr(minimk_syscall_socket_t sock,
+                                        const minimk_sockaddr_t *sa) MINIMK_NOEXCEPT;
+
 /// Function to close a socket instance.
 ///
 /// This function is thread-safe.
@@ -102,10 +133,47 @@ minimk_error_t minimk_syscall_closesocket(minimk_syscall_socket_t *sock) MINIMK_
 ///
 /// The port MUST be a port number in string form.
 ///
+/// We parse the address using minimk_sockaddr_parse and then invoke
+/// minimk_syscall_connect_addr.
+///
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_syscall_connect(minimk_syscall_socket_t sock, const char *address,
                                       const char *port) MINIMK_NOEXCEPT;
 
+/// Like minimk_syscall_connect but using an address parsed with minimk_sockaddr_parse.
+///
+/// This function is thread-safe.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_connect_addr(minimk_syscall_socket_t sock,
+                                           const minimk_sockaddr_t *sa) MINIMK_NOEXCEPT;
+
+/// Function to get the highest ID of the CPUs the calling process may run on, plus one.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The span return argument is set to zero when the function is called and later
+/// changed to the highest CPU ID in the affinity mask plus one on success. This is
+/// the number of listeners a group steered by CPU needs, which is larger than the
+/// number of usable CPUs when the mask has holes, e.g., under a restricted cpuset.
+/// Use minimk_syscall_cpu_pin to find out whether a CPU below the span is usable.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_cpu_span(size_t *span) MINIMK_NOEXCEPT;
+
+/// Function to pin the calling thread to the given CPU.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// Since the runtime uses a single scheduler per process, the way to use all the
+/// cores is to run a process per core, pin each to its own CPU, and have each
+/// accept on its own SO_REUSEPORT listener.
+///
+/// The return value is zero on success or a nonzero error code on failure. We
+/// return MINIMK_EINVAL when cpu does not fit into the kernel CPU set or when the
+/// calling process may not run on it.
+minimk_error_t minimk_syscall_cpu_pin(size_t cpu) MINIMK_NOEXCEPT;
+
 /// Clears the current errno value before invoking a system call.
 void minimk_syscall_clearerrno(void) MINIMK_NOEXCEPT;
 
@@ -128,9 +196,36 @@ minimk_error_t minimk_syscall_geterrno(void) MINIMK_NOEXCEPT;
 ///
 /// The return value is zero on success (getsockopt succeeded) or a nonzero
 /// error code on failure (getsockopt failed).
+/// Function to get the value of a typed socket option.
+///
+/// This function is thread-safe.
+///
+/// The option argument is one of the MINIMK_SOCKOPT_* identifiers.
+///
+/// The value return argument is set to zero when the function is called and
+/// later changed to the option value on success.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_EINVAL if the option is unknown or not supported on this system.
+minimk_error_t minimk_syscall_getsockopt(minimk_syscall_socket_t sock, minimk_sockopt_t option,
+                                         uint64_t *value) MINIMK_NOEXCEPT;
+
 minimk_error_t minimk_syscall_getsockopt_error(minimk_syscall_socket_t sock,
                                                minimk_error_t *error) MINIMK_NOEXCEPT;
 
+/// Function to get the TCP_INFO statistics of a socket.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The sock argument must be a valid stream socket.
+///
+/// The info return argument receives the statistics, except for the time field,
+/// which we do not modify. Fields the running kernel does not provide are zero.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_getsockopt_tcp_info(minimk_syscall_socket_t sock,
+                                                  minimk_tcpinfo_t *info) MINIMK_NOEXCEPT;
+
 /// Function to read the monotonic clock.
 ///
 /// This function is thread safe.
@@ -192,6 +287,71 @@ minimk_error_t minimk_syscall_poll(minimk_syscall_pollfd_t *fds, size_t size, in
 minimk_error_t minimk_syscall_recv(minimk_syscall_socket_t sock, void *data, size_t count,
                                    size_t *nread) MINIMK_NOEXCEPT;
 
+/// Like minimk_syscall_recv but scatters the data into an array of buffers using recvmsg.
+///
+/// The iov argument points to an array of iovcnt buffers, which we fill in order.
+///
+/// We consider at most IOV_MAX buffers, so the read may be short.
+///
+/// The return value is zero on success, MINIMK_EOF on end-of-file, MINIMK_EINVAL
+/// when the buffers contain zero bytes, or a nonzero error code on failure.
+minimk_error_t minimk_syscall_recvv(minimk_syscall_socket_t sock, minimk_iovec_t *iov, size_t iovcnt,
+                                    size_t *nread) MINIMK_NOEXCEPT;
+
+/// Function to receive a datagram along with its source address.
+///
+/// This function is thread-safe.
+///
+/// The sock argument must be a valid datagram socket.
+///
+/// The data argument must be a valid array for receiving the datagram.
+///
+/// The count argument specifies the size of the array. Excess bytes of
+/// a datagram larger than the array are discarded.
+///
+/// The sa return argument is zeroed when the function is called and contains
+/// the source address on success.
+///
+/// The nread return argument will be set to the number of bytes actually read.
+///
+/// Unlike minimk_syscall_recv, zero-length datagrams are valid, so we never return MINIMK_EOF.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_recvfrom(minimk_syscall_socket_t sock, void *data, size_t count,
+                                       minimk_sockaddr_t *sa, size_t *nread) MINIMK_NOEXCEPT;
+
+/// Function to receive a batch of datagrams using a single recvmmsg system call.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The dgrams argument points to an array of count datagrams. The data and count fields
+/// of each datagram must describe a valid nonempty buffer. On success, we set the addr
+/// and length fields of the received datagrams.
+///
+/// We receive at most MINIMK_DATAGRAM_BATCH_MAX datagrams per call. Because the socket is
+/// nonblocking, we return as soon as there are no more pending datagrams.
+///
+/// The nrecv return argument will be set to the number of datagrams received.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_recvmmsg(minimk_syscall_socket_t sock, minimk_datagram_t *dgrams, size_t count,
+                                       size_t *nrecv) MINIMK_NOEXCEPT;
+
+/// Like minimk_syscall_recvfrom but uses recvmsg to also obtain the UDP_GRO segment size.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// When minimk_syscall_setsockopt_udp_gro is enabled, the kernel may coalesce several
+/// datagrams from the same source into data. The segment_size return argument is then
+/// the size of each datagram, except possibly the last. Otherwise, it equals nread.
+///
+/// Use minimk_datagram_segments to split data into per-datagram views.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_recvfrom_gro(minimk_syscall_socket_t sock, void *data, size_t count,
+                                           minimk_sockaddr_t *sa, size_t *segment_size,
+                                           size_t *nread) MINIMK_NOEXCEPT;
+
 /// Function to write bytes to a given socket.
 ///
 /// This function is thread-safe.
@@ -214,6 +374,128 @@ minimk_error_t minimk_syscall_recv(minimk_syscall_socket_t sock, void *data, siz
 minimk_error_t minimk_syscall_send(minimk_syscall_socket_t sock, const void *data, size_t count,
                                    size_t *nwritten) MINIMK_NOEXCEPT;
 
+/// Like minimk_syscall_send but gathers the data from an array of buffers using sendmsg.
+///
+/// The iov argument points to an array of iovcnt buffers, which we send in order.
+///
+/// We consider at most IOV_MAX buffers, so the write may be short.
+///
+/// The return value is zero on success, MINIMK_EINVAL when the buffers
+/// contain zero bytes, or a nonzero error code on failure.
+minimk_error_t minimk_syscall_sendv(minimk_syscall_socket_t sock, const minimk_iovec_t *iov, size_t iovcnt,
+                                    size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Like minimk_syscall_send but uses MSG_ZEROCOPY to avoid copying data into the kernel.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The socket must have been configured with minimk_syscall_setsockopt_zerocopy,
+/// otherwise the kernel silently ignores MSG_ZEROCOPY and copies the data.
+///
+/// On success, the kernel pins the pages containing data and posts a completion
+/// notification on the socket error queue once it does not need them anymore. The
+/// caller MUST NOT modify data until then. Each successful call gets a sequential
+/// 32-bit notification ID starting from zero. Use minimk_syscall_zerocopy_reap
+/// to read the completions.
+///
+/// The return value is zero on success or a nonzero error code on failure. Note that
+/// MINIMK_ENOBUFS means there are too many pending completions, so the caller
+/// should reap some of them before trying again.
+minimk_error_t minimk_syscall_send_zerocopy(minimk_syscall_socket_t sock, const void *data, size_t count,
+                                            size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Function to send file content to a socket using sendfile without user-space copies.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The fd argument must be a file descriptor supporting mmap, such as a regular file.
+/// Like for splice, we use the socket type for it, since it is a plain descriptor.
+///
+/// The offset argument is the file position where to start reading. We do not
+/// change the file position of fd, so the caller must advance offset by nwritten.
+///
+/// The count argument specifies the maximum number of bytes to write.
+///
+/// The return value is zero on success, MINIMK_EOF when offset is at or past the
+/// end of file, MINIMK_EINVAL when count is zero or offset does not fit into off_t,
+/// or a nonzero error code on failure.
+minimk_error_t minimk_syscall_sendfile(minimk_syscall_socket_t sock, minimk_syscall_socket_t fd,
+                                       uint64_t offset, size_t count, size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Function to send a batch of datagrams using a single sendmmsg system call.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The dgrams argument points to an array of count datagrams. The addr, data, and count
+/// fields of each datagram must describe a parsed address and a valid nonempty buffer.
+/// On success, we set the length field of the sent datagrams.
+///
+/// We send at most MINIMK_DATAGRAM_BATCH_MAX datagrams per call.
+///
+/// The nsent return argument will be set to the number of datagrams sent.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_sendmmsg(minimk_syscall_socket_t sock, minimk_datagram_t *dgrams, size_t count,
+                                       size_t *nsent) MINIMK_NOEXCEPT;
+
+/// Function to send a datagram to a given destination address.
+///
+/// This function is thread-safe.
+///
+/// The sock argument must be a valid datagram socket.
+///
+/// The data argument must be a valid array containing the datagram to send.
+///
+/// The count argument specifies the number of bytes to send.
+///
+/// The sa argument must be an address parsed using minimk_sockaddr_parse.
+///
+/// The nwritten return argument will be set to the number of bytes actually written.
+///
+/// Like minimk_syscall_send, we set MSG_NOSIGNAL where available.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_sendto(minimk_syscall_socket_t sock, const void *data, size_t count,
+                                     const minimk_sockaddr_t *sa, size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Like minimk_syscall_sendto but uses UDP_SEGMENT to send many datagrams at once.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The kernel splits data into datagrams of segment_size bytes, except possibly the
+/// last, which may be shorter. The kernel limits the number of segments (64 on Linux)
+/// and the count must not exceed the maximum UDP payload size.
+///
+/// The return value is zero on success or a nonzero error code on failure. We
+/// return MINIMK_EINVAL if segment_size is zero or does not fit into 16 bits.
+minimk_error_t minimk_syscall_sendto_gso(minimk_syscall_socket_t sock, const void *data, size_t count,
+                                         const minimk_sockaddr_t *sa, size_t segment_size,
+                                         size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Function to set the value of a typed socket option.
+///
+/// This function is thread-safe.
+///
+/// The option argument is one of the MINIMK_SOCKOPT_* identifiers.
+///
+/// The return value is zero on success or a nonzero error code on failure. We return
+/// MINIMK_EINVAL if the option is unknown or not supported on this system, or if the
+/// value does not fit into an int for options using an int value.
+minimk_error_t minimk_syscall_setsockopt(minimk_syscall_socket_t sock, minimk_sockopt_t option,
+                                         uint64_t value) MINIMK_NOEXCEPT;
+
+/// Function to set the TCP_CONGESTION socket option.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The algorithm argument is the name of the congestion control algorithm (e.g.,
+/// "bbr" or "cubic"), which must be loaded and, unless we have CAP_NET_ADMIN,
+/// listed in net.ipv4.tcp_allowed_congestion_control.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_setsockopt_congestion(minimk_syscall_socket_t sock,
+                                                    const char *algorithm) MINIMK_NOEXCEPT;
+
 /// Function to set SO_NOSIGPIPE socket option.
 ///
 /// This function is thread-safe.
@@ -240,6 +522,69 @@ minimk_error_t minimk_syscall_setsockopt_nosigpipe(minimk_syscall_socket_t sock)
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_syscall_setsockopt_reuseaddr(minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
 
+/// Function to attach a classic BPF program steering connections by CPU to a SO_REUSEPORT group.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The sock argument must be a socket of the group, which must be bound. The program
+/// applies to the whole group and selects the socket whose index in the group is the
+/// number of the CPU that processes the incoming packet. The index is the order in
+/// which sockets joined the group, so create the listeners in CPU order. When there
+/// are fewer sockets than CPUs, the kernel falls back to hashing.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_setsockopt_reuseport_cbpf_cpu(minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
+
+/// Function to set the UDP_GRO socket option.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The sock argument must be a valid datagram socket.
+///
+/// This function allows the kernel to coalesce consecutive datagrams from the same
+/// source into a single buffer. Use minimk_syscall_recvfrom_gro to receive them.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_setsockopt_udp_gro(minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
+
+/// Function to set the SO_ZEROCOPY socket option.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The sock argument must be a valid stream socket.
+///
+/// This function allows sending with minimk_syscall_send_zerocopy.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_setsockopt_zerocopy(minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
+
+/// Function to create a descriptor for receiving the given signal.
+///
+/// This function is Linux specific and thread-safe.
+///
+/// The fd return argument will be set to the invalid socket when the function
+/// is invoked and later changed to a valid nonblocking descriptor on success.
+///
+/// The signo argument is the signal to receive. We block the signal for the
+/// calling thread using sigprocmask, such that it is only delivered through the
+/// descriptor. Threads created afterwards inherit this mask. When we cannot
+/// create the descriptor, we restore the previous mask.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_signalfd(minimk_syscall_socket_t *fd, int signo) MINIMK_NOEXCEPT;
+
+/// Function to read a pending signal from a descriptor created by minimk_syscall_signalfd.
+///
+/// This function is Linux specific and thread-safe.
+///
+/// The fd argument must be a valid signal descriptor.
+///
+/// The signo return argument will be set to the received signal number.
+///
+/// The return value is zero on success, MINIMK_EAGAIN if there are no pending
+/// signals, or a nonzero error code on failure.
+minimk_error_t minimk_syscall_signalfd_read(minimk_syscall_socket_t fd, int *signo) MINIMK_NOEXCEPT;
+
 /// Function to create a new socket instance.
 ///
 /// This function is thread-safe.
@@ -257,6 +602,18 @@ minimk_error_t minimk_syscall_setsockopt_reuseaddr(minimk_syscall_socket_t sock)
 minimk_error_t minimk_syscall_socket(minimk_syscall_socket_t *sock, int domain, int type,
                                      int protocol) MINIMK_NOEXCEPT;
 
+/// Like minimk_syscall_socket but the socket is nonblocking and close-on-exec.
+///
+/// This function is thread-safe.
+///
+/// On Linux, we pass SOCK_NONBLOCK and SOCK_CLOEXEC to a single socket system call.
+/// Elsewhere, we fall back to socket followed by minimk_syscall_socket_setnonblock,
+/// and the socket is not close-on-exec.
+///
+/// The return value is zero on success or a nonzero error code on failure.
+minimk_error_t minimk_syscall_socket_nonblock(minimk_syscall_socket_t *sock, int domain, int type,
+                                              int protocol) MINIMK_NOEXCEPT;
+
 /// Function for initializing the socket library and its defines.
 ///
 /// This function is not thread-safe and must be called once before using other
@@ -274,6 +631,35 @@ minimk_error_t minimk_syscall_socket_init(void) MINIMK_NOEXCEPT;
 /// The return value is zero on success or a nonzero error code on failure.
 minimk_error_t minimk_syscall_socket_setnonblock(minimk_syscall_socket_t sock) MINIMK_NOEXCEPT;
 
+/// Function to move data from a pipe to a socket using splice without user-space copies.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The pipefd argument must be the read end of a pipe. Like for signalfd, we use the
+/// socket type for it, so the runtime can poll it.
+///
+/// We always use SPLICE_F_NONBLOCK, so MINIMK_EAGAIN means that either the pipe is
+/// empty or the socket is not writable, and the caller must figure out which.
+///
+/// The return value is zero on success, MINIMK_EOF when the pipe is empty and has no
+/// writers, MINIMK_EINVAL when count is zero, or a nonzero error code on failure.
+minimk_error_t minimk_syscall_splice(minimk_syscall_socket_t pipefd, minimk_syscall_socket_t sock,
+                                     size_t count, size_t *nwritten) MINIMK_NOEXCEPT;
+
+/// Function to read a MSG_ZEROCOPY completion from the socket error queue.
+///
+/// This function is thread-safe and only available on Linux.
+///
+/// The lo and hi return arguments will be set to the inclusive range of the
+/// notification IDs (see minimk_syscall_send_zerocopy) that have completed. The
+/// kernel may merge consecutive completions into a single range.
+///
+/// The return value is zero on success, MINIMK_EAGAIN when the error queue is
+/// empty, MINIMK_EINVAL when we dequeued a message that is not a zero-copy
+/// completion, or another nonzero error code on failure.
+minimk_error_t minimk_syscall_zerocopy_reap(minimk_syscall_socket_t sock, uint32_t *lo,
+                                            uint32_t *hi) MINIMK_NOEXCEPT;
+
 MINIMK_END_DECLS
 
 #endif // MINIMK_SYSCALL_H
@@ -0,0 +1,93 @@
+// File: include/minimk/tcpinfo.h
+// Purpose: TCP_INFO samples for throughput measurement
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_TCPINFO_H
+#define MINIMK_TCPINFO_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+/// Portable subset of the kernel TCP_INFO statistics.
+///
+/// Fields that the running kernel does not provide are zero.
+typedef struct minimk_tcpinfo {
+    /// Monotonic time in nanoseconds when we took the sample.
+    uint64_t time;
+
+    /// Smoothed round-trip time in microseconds.
+    uint64_t rtt;
+
+    /// Round-trip time variance in microseconds.
+    uint64_t rttvar;
+
+    /// Minimum observed round-trip time in microseconds.
+    uint64_t min_rtt;
+
+    /// Congestion window in segments.
+    uint64_t snd_cwnd;
+
+    /// Sender maximum segment size in bytes.
+    uint64_t snd_mss;
+
+    /// Number of bytes acknowledged by the peer.
+    uint64_t bytes_acked;
+
+    /// Number of bytes received from the peer.
+    uint64_t bytes_received;
+
+    /// Number of bytes sent, including retransmissions.
+    uint64_t bytes_sent;
+
+    /// Number of bytes retransmitted.
+    uint64_t bytes_retrans;
+
+    /// Total number of retransmitted segments.
+    uint64_t total_retrans;
+
+    /// Most recent delivery rate estimate in bytes per second.
+    uint64_t delivery_rate;
+
+    /// Pacing rate in bytes per second.
+    uint64_t pacing_rate;
+
+    /// Microseconds spent with data in flight.
+    uint64_t busy_time;
+
+    /// Microseconds spent limited by the receiver window.
+    uint64_t rwnd_limited;
+
+    /// Microseconds spent limited by the send buffer.
+    uint64_t sndbuf_limited;
+} minimk_tcpinfo_t;
+
+/// Fixed-size ring of TCP_INFO samples backed by caller-provided storage.
+///
+/// Once full, each new sample overwrites the oldest one.
+typedef struct minimk_tcpinfo_ring {
+    /// Array of capacity samples.
+    minimk_tcpinfo_t *base;
+
+    /// Number of entries in base.
+    size_t capacity;
+
+    /// Total number of samples pushed so far, including overwritten ones.
+    size_t count;
+} minimk_tcpinfo_ring_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Initializes the ring to use the given array of capacity samples.
+void minimk_tcpinfo_ring_init(minimk_tcpinfo_ring_t *ring, minimk_tcpinfo_t *base,
+                              size_t capacity) MINIMK_NOEXCEPT;
+
+/// Copies the sample into the ring, possibly overwriting the oldest one.
+void minimk_tcpinfo_ring_push(minimk_tcpinfo_ring_t *ring, const minimk_tcpinfo_t *sample) MINIMK_NOEXCEPT;
+
+/// Returns the idx-th oldest sample still in the ring or NULL if idx is out of range.
+const minimk_tcpinfo_t *minimk_tcpinfo_ring_at(const minimk_tcpinfo_ring_t *ring, size_t idx) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_TCPINFO_H
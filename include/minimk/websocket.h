@@ -0,0 +1,119 @@
+// File: include/minimk/websocket.h
+// Purpose: minimal RFC 6455 WebSocket handshake and framing
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef MINIMK_WEBSOCKET_H
+#define MINIMK_WEBSOCKET_H
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/cdefs.h>     // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/socket.h>    // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t, uint64_t
+
+/// Opcode of a continuation frame.
+#define MINIMK_WEBSOCKET_OPCODE_CONTINUATION 0x0
+
+/// Opcode of a text frame.
+#define MINIMK_WEBSOCKET_OPCODE_TEXT 0x1
+
+/// Opcode of a binary frame.
+#define MINIMK_WEBSOCKET_OPCODE_BINARY 0x2
+
+/// Opcode of a close frame.
+#define MINIMK_WEBSOCKET_OPCODE_CLOSE 0x8
+
+/// Opcode of a ping frame.
+#define MINIMK_WEBSOCKET_OPCODE_PING 0x9
+
+/// Opcode of a pong frame.
+#define MINIMK_WEBSOCKET_OPCODE_PONG 0xA
+
+/// Frame flag indicating the final fragment of a message.
+#define MINIMK_WEBSOCKET_FLAG_FIN (1 << 0)
+
+/// Frame flag indicating that the payload is masked.
+#define MINIMK_WEBSOCKET_FLAG_MASK (1 << 1)
+
+/// Maximum size of an encoded frame header.
+#define MINIMK_WEBSOCKET_MAX_HEADER 14
+
+/// Size of the Sec-WebSocket-Accept value including the terminating zero.
+#define MINIMK_WEBSOCKET_ACCEPT_SIZE 29
+
+/// Decoded WebSocket frame header.
+typedef struct minimk_websocket_frame {
+    /// Payload length in bytes.
+    uint64_t length;
+
+    /// Frame opcode using MINIMK_WEBSOCKET_OPCODE_*.
+    uint32_t opcode;
+
+    /// Frame flags using MINIMK_WEBSOCKET_FLAG_*.
+    uint32_t flags;
+
+    /// Masking key in network byte order, valid with MINIMK_WEBSOCKET_FLAG_MASK.
+    uint32_t maskkey;
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+} minimk_websocket_frame_t;
+
+MINIMK_BEGIN_DECLS
+
+/// Compute the Sec-WebSocket-Accept value for a Sec-WebSocket-Key.
+///
+/// The accept argument must point to MINIMK_WEBSOCKET_ACCEPT_SIZE bytes and
+/// receives a zero-terminated string.
+void minimk_websocket_accept_key(const char *key, size_t keylen, char *accept) MINIMK_NOEXCEPT;
+
+/// Perform the client side of the opening handshake.
+///
+/// We send the upgrade request for the given host, path, and subprotocol
+/// through writer, using the 16 bytes at nonce as the Sec-WebSocket-Key,
+/// flush it, and read the response through reader.
+///
+/// On success, any frame bytes the server sent right after the response
+/// remain buffered inside reader.
+///
+/// We return MINIMK_EINVAL when the server does not switch protocols, omits
+/// the Upgrade or Connection headers required by RFC 6455, does not confirm
+/// the subprotocol, or sends an invalid accept value.
+minimk_error_t minimk_websocket_client_handshake(minimk_bufreader_t *reader, minimk_bufwriter_t *writer,
+                                                 const char *host, const char *path, const char *protocol,
+                                                 const uint8_t *nonce) MINIMK_NOEXCEPT;
+
+/// Read and decode the next frame header from reader.
+///
+/// The payload follows in reader and the caller must consume exactly
+/// frame->length bytes before reading the next header.
+///
+/// We return MINIMK_EINVAL for reserved bits, unknown opcodes, and invalid
+/// control frames.
+minimk_error_t minimk_websocket_read_header(minimk_bufreader_t *reader,
+                                            minimk_websocket_frame_t *frame) MINIMK_NOEXCEPT;
+
+/// Encode a frame header into out, which must hold MINIMK_WEBSOCKET_MAX_HEADER bytes.
+///
+/// Returns the number of bytes we encoded.
+size_t minimk_websocket_encode_header(const minimk_websocket_frame_t *frame, uint8_t *out) MINIMK_NOEXCEPT;
+
+/// XOR count bytes at data with the masking key, starting at the given payload offset.
+///
+/// Masking is an involution, so this function also unmasks.
+void minimk_websocket_mask(void *data, size_t count, uint32_t maskkey, uint64_t offset) MINIMK_NOEXCEPT;
+
+/// Send a frame header followed by its payload using a single writev.
+///
+/// We send the payload as is, so the caller is responsible for masking it
+/// when frame has MINIMK_WEBSOCKET_FLAG_MASK. The payload length must match
+/// frame->length.
+minimk_error_t minimk_websocket_send_frame(minimk_socket_t sock, const minimk_websocket_frame_t *frame,
+                                           const void *payload) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // MINIMK_WEBSOCKET_H
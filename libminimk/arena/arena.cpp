@@ -0,0 +1,126 @@
+// File: libminimk/arena/arena.cpp
+// Purpose: bump-pointer arena allocator
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "../chunk/chunk.h" // for minimk_chunk_map
+
+#include "chunk.h" // for struct minimk_arena_chunk
+
+#include <minimk/arena.h> // for minimk_arena_t
+#include <minimk/cdefs.h> // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uintptr_t, SIZE_MAX
+
+/// Return the first payload byte of a chunk.
+static char *minimk_arena_chunk_begin(struct minimk_arena_chunk *chunk) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return static_cast<char *>(static_cast<void *>(chunk + 1));
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+/// Return one past the last payload byte of a chunk.
+static char *minimk_arena_chunk_end(struct minimk_arena_chunk *chunk) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return static_cast<char *>(static_cast<void *>(chunk)) + chunk->size;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+/// Make the given chunk the one we allocate from.
+static void minimk_arena_enter(minimk_arena_t *arena, struct minimk_arena_chunk *chunk) noexcept {
+    arena->current = chunk;
+    arena->cursor = minimk_arena_chunk_begin(chunk);
+    arena->limit = minimk_arena_chunk_end(chunk);
+}
+
+void minimk_arena_init(minimk_arena_t *arena, size_t chunk_size) noexcept {
+    arena->first = nullptr;
+    arena->current = nullptr;
+    arena->cursor = nullptr;
+    arena->limit = nullptr;
+    arena->chunk_size = (chunk_size > 0) ? chunk_size : MINIMK_ARENA_DEFAULT_CHUNK_SIZE;
+}
+
+minimk_error_t minimk_arena_alloc(minimk_arena_t *arena, size_t size, size_t align, void **ptr) noexcept {
+    *ptr = nullptr;
+    if (size <= 0 || align <= 0 || (align & (align - 1)) != 0) {
+        return MINIMK_EINVAL;
+    }
+
+    // Make sure the worst-case request size does not overflow
+    size_t header = sizeof(struct minimk_arena_chunk);
+    if (size > SIZE_MAX - header - align) {
+        return MINIMK_ENOMEM;
+    }
+    size_t worst = size + align - 1;
+
+    for (;;) {
+        // Fast path: bump the cursor inside the current chunk
+        if (arena->cursor != nullptr) {
+            uintptr_t cursor = reinterpret_cast<uintptr_t>(arena->cursor);
+            uintptr_t limit = reinterpret_cast<uintptr_t>(arena->limit);
+            uintptr_t aligned = (cursor + align - 1) & ~static_cast<uintptr_t>(align - 1);
+            if (aligned <= limit && size <= limit - aligned) {
+                MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+                arena->cursor += (aligned - cursor) + size;
+                *ptr = arena->cursor - size;
+                MINIMK_UNSAFE_BUFFER_USAGE_END
+                return 0;
+            }
+        }
+
+        // Reuse the next chunk we kept across resets when it is large enough
+        struct minimk_arena_chunk *next = (arena->current != nullptr) ? arena->current->next : arena->first;
+        if (next != nullptr && next->size - header >= worst) {
+            minimk_arena_enter(arena, next);
+            continue;
+        }
+
+        // Otherwise map a new chunk, which is dedicated when the request is large
+        bool dedicated = header + worst > arena->chunk_size;
+        void *base = nullptr;
+        size_t mapped = 0;
+        minimk_error_t rv = minimk_chunk_map(&base, dedicated ? header + worst : arena->chunk_size, &mapped);
+        if (rv != 0) {
+            return rv;
+        }
+        auto chunk = static_cast<struct minimk_arena_chunk *>(base);
+        chunk->size = mapped;
+
+        // Keep bumping the current chunk after a dedicated allocation, since it
+        // likely has room left, by linking the new chunk among the used ones
+        if (dedicated && arena->current != nullptr) {
+            chunk->next = arena->first;
+            arena->first = chunk;
+            uintptr_t begin = reinterpret_cast<uintptr_t>(minimk_arena_chunk_begin(chunk));
+            uintptr_t aligned = (begin + align - 1) & ~static_cast<uintptr_t>(align - 1);
+            *ptr = reinterpret_cast<void *>(aligned);
+            return 0;
+        }
+
+        chunk->next = next;
+        if (arena->current != nullptr) {
+            arena->current->next = chunk;
+        } else {
+            arena->first = chunk;
+        }
+        minimk_arena_enter(arena, chunk);
+    }
+}
+
+void minimk_arena_reset(minimk_arena_t *arena) noexcept {
+    arena->current = nullptr;
+    arena->cursor = nullptr;
+    arena->limit = nullptr;
+}
+
+void minimk_arena_destroy(minimk_arena_t *arena) noexcept {
+    struct minimk_arena_chunk *chunk = arena->first;
+    while (chunk != nullptr) {
+        struct minimk_arena_chunk *next = chunk->next;
+        minimk_chunk_unmap(chunk, chunk->size);
+        chunk = next;
+    }
+    minimk_arena_init(arena, arena->chunk_size);
+}
@@ -0,0 +1,20 @@
+// File: libminimk/arena/chunk.h
+// Purpose: arena chunk layout
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_ARENA_CHUNK_H
+#define LIBMINIMK_ARENA_CHUNK_H
+
+#include <stddef.h> // for size_t
+
+/// Header at the beginning of each arena chunk, which the payload follows.
+///
+/// We map chunks using minimk_chunk_map, so the whole chunk spans whole pages.
+struct minimk_arena_chunk {
+    /// Next chunk in the arena chain or NULL.
+    struct minimk_arena_chunk *next;
+
+    /// Size of the whole mapping in bytes, including this header.
+    size_t size;
+};
+
+#endif // LIBMINIMK_ARENA_CHUNK_H
@@ -0,0 +1,63 @@
+// File: libminimk/arena/local.cpp
+// Purpose: coroutine-local arenas
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "../slab/pool.hpp" // for minimk_slab_pool_for_size
+
+#include <minimk/arena.h>   // for minimk_arena_t
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_local_get
+
+#include <stddef.h> // for size_t
+
+/// Return the pool of coroutine-local arena descriptors.
+static struct minimk_slab_pool *minimk_arena_local_pool(void) noexcept {
+    return minimk_slab_pool_for_size<sizeof(minimk_arena_t)>();
+}
+
+/// Coroutine-local storage key plus one, or zero when not allocated yet.
+static size_t local_key = 0;
+
+/// Destructor the runtime invokes when a coroutine with an arena exits.
+static void minimk_arena_local_destroy(void *value) noexcept {
+    auto arena = static_cast<minimk_arena_t *>(value);
+    minimk_arena_destroy(arena);
+    minimk_slab_pool_free(minimk_arena_local_pool(), arena);
+}
+
+minimk_error_t minimk_arena_local(minimk_arena_t **parena) noexcept {
+    *parena = nullptr;
+
+    // Allocate the key the first time any coroutine asks for an arena
+    if (local_key <= 0) {
+        size_t key = 0;
+        minimk_error_t rv = minimk_runtime_local_key_create(&key, minimk_arena_local_destroy);
+        if (rv != 0) {
+            return rv;
+        }
+        local_key = key + 1;
+    }
+
+    // Return the arena this coroutine already has
+    auto arena = static_cast<minimk_arena_t *>(minimk_runtime_local_get(local_key - 1));
+    if (arena != nullptr) {
+        *parena = arena;
+        return 0;
+    }
+
+    // Bind a fresh arena to the running coroutine
+    void *obj = nullptr;
+    minimk_error_t rv = minimk_slab_pool_alloc(minimk_arena_local_pool(), &obj);
+    if (rv != 0) {
+        return rv;
+    }
+    rv = minimk_runtime_local_set(local_key - 1, obj);
+    if (rv != 0) {
+        minimk_slab_pool_free(minimk_arena_local_pool(), obj);
+        return rv;
+    }
+    arena = static_cast<minimk_arena_t *>(obj);
+    minimk_arena_init(arena, 0);
+    *parena = arena;
+    return 0;
+}
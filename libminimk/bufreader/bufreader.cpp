@@ -0,0 +1,47 @@
+// File: libminimk/bufreader/bufreader.cpp
+// Purpose: buffered reader initialization and bookkeeping
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/socket.h>    // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_bufreader_init(minimk_bufreader_t *reader, minimk_socket_t sock, void *base,
+                                     size_t capacity) noexcept {
+    // Masking the monotonic counters requires a power of two
+    if (base == nullptr || capacity <= 0 || (capacity & (capacity - 1)) != 0) {
+        return MINIMK_EINVAL;
+    }
+    reader->sock = sock;
+    reader->base = static_cast<char *>(base);
+    reader->capacity = capacity;
+    reader->head = 0;
+    reader->tail = 0;
+    reader->writer = nullptr;
+    return 0;
+}
+
+void minimk_bufreader_set_writer(minimk_bufreader_t *reader, minimk_bufwriter_t *writer) noexcept {
+    reader->writer = writer;
+}
+
+size_t minimk_bufreader_buffered(const minimk_bufreader_t *reader) noexcept {
+    return reader->tail - reader->head;
+}
+
+minimk_error_t minimk_bufreader_consume(minimk_bufreader_t *reader, size_t count) noexcept {
+    if (count > reader->tail - reader->head) {
+        return MINIMK_EINVAL;
+    }
+    reader->head += count;
+
+    // Restart from offset zero when empty so the next data is contiguous
+    if (reader->head == reader->tail) {
+        reader->head = 0;
+        reader->tail = 0;
+    }
+    return 0;
+}
@@ -0,0 +1,12 @@
+// File: libminimk/bufreader/fill.cpp
+// Purpose: fill implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "fill.hpp" // for minimk_bufreader_fill_impl
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/errno.h>     // for minimk_error_t
+
+minimk_error_t minimk_bufreader_fill(minimk_bufreader_t *reader) noexcept {
+    return minimk_bufreader_fill_impl(reader);
+}
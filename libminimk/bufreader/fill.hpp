@@ -0,0 +1,68 @@
+// File: libminimk/bufreader/fill.hpp
+// Purpose: fill implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFREADER_FILL_HPP
+#define LIBMINIMK_BUFREADER_FILL_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+#include "ring.hpp"           // for minimk_bufreader_tail_offset
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/bufwriter.h> // for minimk_bufwriter_flush
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/socket.h>    // for minimk_socket_recvv
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_bufreader_fill implementation.
+template <decltype(minimk_socket_recvv) M_recvv = minimk_socket_recvv,
+          decltype(minimk_bufwriter_flush) M_flush = minimk_bufwriter_flush>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_bufreader_fill_impl(minimk_bufreader_t *reader) noexcept {
+    // Refuse to issue a zero-length read when the ring is full
+    size_t avail = reader->capacity - (reader->tail - reader->head);
+    if (avail <= 0) {
+        return MINIMK_ENOBUFS;
+    }
+
+    // Make sure the peer has everything it needs to answer us
+    if (reader->writer != nullptr) {
+        minimk_error_t rv = M_flush(reader->writer);
+        if (rv != 0) {
+            return rv;
+        }
+    }
+
+    // Describe the free space, which wraps at most once
+    size_t offset = minimk_bufreader_tail_offset(reader);
+    size_t first = reader->capacity - offset;
+    first = (first < avail) ? first : avail;
+    minimk_iovec_t iov[2];
+    size_t iovcnt = 1;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    iov[0].base = reader->base + offset;
+    iov[0].len = first;
+    if (first < avail) {
+        iov[1].base = reader->base;
+        iov[1].len = avail - first;
+        iovcnt = 2;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Receive as much as the kernel has ready in a single call
+    size_t nread = 0;
+    minimk_error_t rv = M_recvv(reader->sock, iov, iovcnt, &nread);
+    MINIMK_TRACE_SOCKET("bufreader_fill handle=0x%llx\n", CAST_ULL(reader->sock));
+    MINIMK_TRACE_SOCKET("bufreader_fill avail=%zu\n", avail);
+    MINIMK_TRACE_SOCKET("bufreader_fill nread=%zu\n", nread);
+    MINIMK_TRACE_SOCKET("bufreader_fill result=%s\n", minimk_errno_name(rv));
+    if (rv != 0) {
+        return rv;
+    }
+    reader->tail += nread;
+    return 0;
+}
+
+#endif // LIBMINIMK_BUFREADER_FILL_HPP
@@ -0,0 +1,13 @@
+// File: libminimk/bufreader/peek.cpp
+// Purpose: peek implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "peek.hpp" // for minimk_bufreader_peek_impl
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+
+minimk_error_t minimk_bufreader_peek(minimk_bufreader_t *reader, minimk_iovec_t *view) noexcept {
+    return minimk_bufreader_peek_impl(reader, view);
+}
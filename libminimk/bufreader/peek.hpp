@@ -0,0 +1,39 @@
+// File: libminimk/bufreader/peek.hpp
+// Purpose: peek implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFREADER_PEEK_HPP
+#define LIBMINIMK_BUFREADER_PEEK_HPP
+
+#include "ring.hpp" // for minimk_bufreader_head_offset
+
+#include <minimk/bufreader.h> // for minimk_bufreader_fill
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_bufreader_peek implementation.
+template <decltype(minimk_bufreader_fill) M_fill = minimk_bufreader_fill>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_bufreader_peek_impl(minimk_bufreader_t *reader,
+                                                               minimk_iovec_t *view) noexcept {
+    // Make sure there is something to look at
+    if (reader->tail == reader->head) {
+        minimk_error_t rv = M_fill(reader);
+        if (rv != 0) {
+            return rv;
+        }
+    }
+
+    // Return the data up to the end of the buffered region or of the ring
+    size_t used = reader->tail - reader->head;
+    size_t offset = minimk_bufreader_head_offset(reader);
+    size_t first = reader->capacity - offset;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    view->base = reader->base + offset;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    view->len = (first < used) ? first : used;
+    return 0;
+}
+
+#endif // LIBMINIMK_BUFREADER_PEEK_HPP
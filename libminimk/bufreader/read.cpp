@@ -0,0 +1,15 @@
+// File: libminimk/bufreader/read.cpp
+// Purpose: read implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "read.hpp" // for minimk_bufreader_read_impl
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/errno.h>     // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_bufreader_read(minimk_bufreader_t *reader, void *data, size_t count,
+                                     size_t *nread) noexcept {
+    return minimk_bufreader_read_impl(reader, data, count, nread);
+}
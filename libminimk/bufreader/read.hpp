@@ -0,0 +1,49 @@
+// File: libminimk/bufreader/read.hpp
+// Purpose: read implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFREADER_READ_HPP
+#define LIBMINIMK_BUFREADER_READ_HPP
+
+#include "ring.hpp" // for minimk_bufreader_head_offset
+
+#include <minimk/bufreader.h> // for minimk_bufreader_fill
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+
+#include <stddef.h> // for size_t
+#include <string.h> // for memcpy
+
+/// Testable minimk_bufreader_read implementation.
+template <decltype(minimk_bufreader_fill) M_fill = minimk_bufreader_fill>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_bufreader_read_impl(minimk_bufreader_t *reader, void *data,
+                                                               size_t count, size_t *nread) noexcept {
+    *nread = 0;
+    if (count <= 0) {
+        return MINIMK_EINVAL;
+    }
+
+    // Make sure there is something to copy
+    if (reader->tail == reader->head) {
+        minimk_error_t rv = M_fill(reader);
+        if (rv != 0) {
+            return rv;
+        }
+    }
+
+    // Copy the buffered data, which wraps at most once
+    size_t used = reader->tail - reader->head;
+    size_t total = (count < used) ? count : used;
+    size_t offset = minimk_bufreader_head_offset(reader);
+    size_t first = reader->capacity - offset;
+    first = (first < total) ? first : total;
+    char *dest = static_cast<char *>(data);
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    memcpy(dest, reader->base + offset, first);
+    memcpy(dest + first, reader->base, total - first);
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    *nread = total;
+    return minimk_bufreader_consume(reader, total);
+}
+
+#endif // LIBMINIMK_BUFREADER_READ_HPP
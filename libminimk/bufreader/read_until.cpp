@@ -0,0 +1,16 @@
+// File: libminimk/bufreader/read_until.cpp
+// Purpose: read_until implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "read_until.hpp" // for minimk_bufreader_read_until_impl
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_bufreader_read_until(minimk_bufreader_t *reader, const char *delim, size_t delimlen,
+                                           minimk_iovec_t *view) noexcept {
+    return minimk_bufreader_read_until_impl(reader, delim, delimlen, view);
+}
@@ -0,0 +1,89 @@
+// File: libminimk/bufreader/read_until.hpp
+// Purpose: read_until implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFREADER_READ_UNTIL_HPP
+#define LIBMINIMK_BUFREADER_READ_UNTIL_HPP
+
+#include "ring.hpp" // for minimk_bufreader_linearize
+
+#include <minimk/bufreader.h> // for minimk_bufreader_fill
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+
+#include <stddef.h> // for size_t
+#include <string.h> // for memchr, memcmp
+
+/// Find delim inside [start, start + size) beginning the search at skip.
+///
+/// We use memchr to locate candidates for the first delimiter byte, which
+/// the C library implements with vector instructions, and compare the rest
+/// of the delimiter only at candidate positions.
+///
+/// Returns the offset of the delimiter or size when not found.
+static inline size_t minimk_bufreader_scan(const char *start, size_t size, size_t skip,
+                                           const char *delim, size_t delimlen) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    while (skip + delimlen <= size) {
+        const void *found = memchr(start + skip, delim[0], size - skip - delimlen + 1);
+        if (found == nullptr) {
+            break;
+        }
+        size_t pos = static_cast<size_t>(static_cast<const char *>(found) - start);
+        if (memcmp(start + pos + 1, delim + 1, delimlen - 1) == 0) {
+            return pos;
+        }
+        skip = pos + 1;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return size;
+}
+
+/// Testable minimk_bufreader_read_until implementation.
+template <decltype(minimk_bufreader_fill) M_fill = minimk_bufreader_fill>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_bufreader_read_until_impl(minimk_bufreader_t *reader, const char *delim, size_t delimlen,
+                                 minimk_iovec_t *view) noexcept {
+    view->base = nullptr;
+    view->len = 0;
+    if (delimlen <= 0 || delimlen > reader->capacity) {
+        return MINIMK_EINVAL;
+    }
+
+    // Remember how much we scanned so each byte is examined once
+    size_t scanned = 0;
+    for (;;) {
+        // Make the buffered data contiguous before scanning it
+        size_t used = reader->tail - reader->head;
+        if (minimk_bufreader_head_offset(reader) + used > reader->capacity) {
+            minimk_bufreader_linearize(reader);
+        }
+
+        // Search the bytes that arrived since the previous iteration
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        char *start = reader->base + minimk_bufreader_head_offset(reader);
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        size_t pos = minimk_bufreader_scan(start, used, scanned, delim, delimlen);
+        if (pos < used) {
+            view->base = start;
+            view->len = pos + delimlen;
+            return minimk_bufreader_consume(reader, view->len);
+        }
+
+        // A partial delimiter may sit at the end of the scanned region
+        scanned = (used >= delimlen) ? used - delimlen + 1 : 0;
+
+        // Avoid waiting forever for a line that cannot fit
+        if (used >= reader->capacity) {
+            return MINIMK_ENOBUFS;
+        }
+
+        // Wait for more data from the peer
+        minimk_error_t rv = M_fill(reader);
+        if (rv != 0) {
+            return rv;
+        }
+    }
+}
+
+#endif // LIBMINIMK_BUFREADER_READ_UNTIL_HPP
@@ -0,0 +1,52 @@
+// File: libminimk/bufreader/ring.hpp
+// Purpose: ring buffer helpers for the buffered reader
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFREADER_RING_HPP
+#define LIBMINIMK_BUFREADER_RING_HPP
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/cdefs.h>     // for MINIMK_UNSAFE_BUFFER_USAGE_*
+
+#include <stddef.h> // for size_t
+
+/// Return the offset of the first buffered byte inside the ring storage.
+static inline size_t minimk_bufreader_head_offset(const minimk_bufreader_t *reader) noexcept {
+    return reader->head & (reader->capacity - 1);
+}
+
+/// Return the offset of the first free byte inside the ring storage.
+static inline size_t minimk_bufreader_tail_offset(const minimk_bufreader_t *reader) noexcept {
+    return reader->tail & (reader->capacity - 1);
+}
+
+/// Reverse the bytes in [first, last) in place.
+static inline void minimk_bufreader_reverse(char *first, char *last) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    while (first < last) {
+        char tmp = *first;
+        *first++ = *--last;
+        *last = tmp;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+/// Rotate the ring storage so that the buffered data starts at offset zero.
+///
+/// We use three in-place reversals, which needs no scratch memory. This only
+/// runs when a scan would otherwise straddle the end of the ring, so the
+/// linear cost amortizes over the capacity bytes received since the last time.
+static inline void minimk_bufreader_linearize(minimk_bufreader_t *reader) noexcept {
+    size_t used = reader->tail - reader->head;
+    size_t offset = minimk_bufreader_head_offset(reader);
+    if (offset != 0) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        minimk_bufreader_reverse(reader->base, reader->base + offset);
+        minimk_bufreader_reverse(reader->base + offset, reader->base + reader->capacity);
+        minimk_bufreader_reverse(reader->base, reader->base + reader->capacity);
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+    }
+    reader->head = 0;
+    reader->tail = used;
+}
+
+#endif // LIBMINIMK_BUFREADER_RING_HPP
@@ -0,0 +1,30 @@
+// File: libminimk/bufwriter/bufwriter.cpp
+// Purpose: buffered writer initialization and configuration
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/socket.h>    // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_bufwriter_init(minimk_bufwriter_t *writer, minimk_socket_t sock, void *base,
+                                     size_t capacity) noexcept {
+    if (base == nullptr || capacity <= 0) {
+        return MINIMK_EINVAL;
+    }
+    writer->sock = sock;
+    writer->base = static_cast<char *>(base);
+    writer->capacity = capacity;
+    writer->len = 0;
+    writer->threshold = capacity;
+    return 0;
+}
+
+minimk_error_t minimk_bufwriter_set_threshold(minimk_bufwriter_t *writer, size_t threshold) noexcept {
+    if (threshold <= 0 || threshold > writer->capacity) {
+        return MINIMK_EINVAL;
+    }
+    writer->threshold = threshold;
+    return 0;
+}
@@ -0,0 +1,12 @@
+// File: libminimk/bufwriter/flush.cpp
+// Purpose: flush implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "flush.hpp" // for minimk_bufwriter_flush_impl
+
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/errno.h>     // for minimk_error_t
+
+minimk_error_t minimk_bufwriter_flush(minimk_bufwriter_t *writer) noexcept {
+    return minimk_bufwriter_flush_impl(writer);
+}
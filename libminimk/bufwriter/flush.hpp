@@ -0,0 +1,33 @@
+// File: libminimk/bufwriter/flush.hpp
+// Purpose: flush implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFWRITER_FLUSH_HPP
+#define LIBMINIMK_BUFWRITER_FLUSH_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/socket.h>    // for minimk_socket_sendall
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_bufwriter_flush implementation.
+template <decltype(minimk_socket_sendall) M_sendall = minimk_socket_sendall>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_bufwriter_flush_impl(minimk_bufwriter_t *writer) noexcept {
+    // Avoid issuing a system call when there is nothing to send
+    if (writer->len <= 0) {
+        return 0;
+    }
+    size_t count = writer->len;
+    writer->len = 0;
+    minimk_error_t rv = M_sendall(writer->sock, writer->base, count);
+    MINIMK_TRACE_SOCKET("bufwriter_flush handle=0x%llx\n", CAST_ULL(writer->sock));
+    MINIMK_TRACE_SOCKET("bufwriter_flush count=%zu\n", count);
+    MINIMK_TRACE_SOCKET("bufwriter_flush result=%s\n", minimk_errno_name(rv));
+    return rv;
+}
+
+#endif // LIBMINIMK_BUFWRITER_FLUSH_HPP
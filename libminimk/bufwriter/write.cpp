@@ -0,0 +1,14 @@
+// File: libminimk/bufwriter/write.cpp
+// Purpose: write implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "write.hpp" // for minimk_bufwriter_write_impl
+
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/errno.h>     // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_bufwriter_write(minimk_bufwriter_t *writer, const void *data, size_t count) noexcept {
+    return minimk_bufwriter_write_impl(writer, data, count);
+}
@@ -0,0 +1,61 @@
+// File: libminimk/bufwriter/write.hpp
+// Purpose: write implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_BUFWRITER_WRITE_HPP
+#define LIBMINIMK_BUFWRITER_WRITE_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include <minimk/bufwriter.h> // for minimk_bufwriter_flush
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/socket.h>    // for minimk_socket_sendallv
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <string.h> // for memcpy
+
+/// Testable minimk_bufwriter_write implementation.
+template <decltype(minimk_socket_sendallv) M_sendallv = minimk_socket_sendallv,
+          decltype(minimk_bufwriter_flush) M_flush = minimk_bufwriter_flush>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_bufwriter_write_impl(minimk_bufwriter_t *writer, const void *data,
+                                                                size_t count) noexcept {
+    if (count <= 0) {
+        return MINIMK_EINVAL;
+    }
+
+    // Pass large writes through along with the buffered data using a single writev
+    if (count > writer->capacity - writer->len) {
+        minimk_iovec_t iov[2];
+        size_t iovcnt = 0;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        if (writer->len > 0) {
+            iov[iovcnt].base = writer->base;
+            iov[iovcnt].len = writer->len;
+            iovcnt++;
+        }
+        iov[iovcnt].base = const_cast<void *>(data);
+        iov[iovcnt].len = count;
+        iovcnt++;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        writer->len = 0;
+        minimk_error_t rv = M_sendallv(writer->sock, iov, iovcnt);
+        MINIMK_TRACE_SOCKET("bufwriter_write handle=0x%llx\n", CAST_ULL(writer->sock));
+        MINIMK_TRACE_SOCKET("bufwriter_write passthrough=%zu\n", count);
+        MINIMK_TRACE_SOCKET("bufwriter_write result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    // Otherwise coalesce and flush once we reach the threshold
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    memcpy(writer->base + writer->len, data, count);
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    writer->len += count;
+    if (writer->len >= writer->threshold) {
+        return M_flush(writer);
+    }
+    return 0;
+}
+
+#endif // LIBMINIMK_BUFWRITER_WRITE_HPP
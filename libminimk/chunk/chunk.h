@@ -0,0 +1,35 @@
+// File: libminimk/chunk/chunk.h
+// Purpose: page-granular memory chunks shared by the allocators
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_CHUNK_CHUNK_H
+#define LIBMINIMK_CHUNK_CHUNK_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+MINIMK_BEGIN_DECLS
+
+/// Maps zero-initialized anonymous memory for a chunk.
+///
+/// The base argument is where we store the chunk address. On failure, we set it to NULL.
+///
+/// The size argument is the minimum chunk size in bytes, which we round up to
+/// the page size, since the kernel maps whole pages anyway.
+///
+/// The mapped argument is set to zero when the function is called and later
+/// changed to the rounded size on success. Callers may use all of it and must
+/// pass it to minimk_chunk_unmap.
+///
+/// Returns zero on success and MINIMK_ENOMEM on failure.
+minimk_error_t minimk_chunk_map(void **base, size_t size, size_t *mapped) MINIMK_NOEXCEPT;
+
+/// Unmaps a chunk previously mapped using minimk_chunk_map.
+///
+/// The size argument must be the mapped size minimk_chunk_map returned.
+void minimk_chunk_unmap(void *base, size_t size) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_CHUNK_CHUNK_H
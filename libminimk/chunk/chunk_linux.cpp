@@ -0,0 +1,18 @@
+// File: libminimk/chunk/chunk_linux.cpp
+// Purpose: page-granular memory chunks for linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "chunk.h"         // for minimk_chunk_map
+#include "chunk_linux.hpp" // for minimk_chunk_map_impl
+
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_chunk_map(void **base, size_t size, size_t *mapped) noexcept {
+    return minimk_chunk_map_impl(base, size, mapped);
+}
+
+void minimk_chunk_unmap(void *base, size_t size) noexcept {
+    minimk_chunk_unmap_impl(base, size);
+}
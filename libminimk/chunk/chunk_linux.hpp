@@ -0,0 +1,75 @@
+// File: libminimk/chunk/chunk_linux.hpp
+// Purpose: page-granular memory chunks for linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_CHUNK_CHUNK_LINUX_HPP
+#define LIBMINIMK_CHUNK_CHUNK_LINUX_HPP
+
+#include "../cast/static.hpp" // for CAST_U
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_clearerrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/mman.h> // for mmap, munmap
+#include <unistd.h>   // for sysconf
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for SIZE_MAX
+
+/// Testable implementation of minimk_chunk_map
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(sysconf) M_sys_sysconf = sysconf,
+          decltype(mmap) M_sys_mmap = mmap>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_chunk_map_impl(void **base, size_t size, size_t *mapped) noexcept {
+    // Zero the return arguments
+    *base = nullptr;
+    *mapped = 0;
+
+    // Round the size up to the page size, making sure it does not overflow
+    long pagesize = M_sys_sysconf(_SC_PAGESIZE);
+    size_t page = (pagesize > 0) ? static_cast<size_t>(pagesize) : static_cast<size_t>(4096);
+    if (size <= 0 || size > SIZE_MAX - (page - 1)) {
+        MINIMK_TRACE_SYSCALL("mmap: suspicious length=%zu\n", size);
+        return MINIMK_ENOMEM;
+    }
+    size = ((size + page - 1) / page) * page;
+
+    // Use mmap since anonymous mappings are already zero-initialized and
+    // unmapping returns the memory to the kernel
+    M_minimk_syscall_clearerrno();
+    int prot = PROT_READ | PROT_WRITE;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    MINIMK_TRACE_SYSCALL("mmap: addr=%s\n", "nullptr");
+    MINIMK_TRACE_SYSCALL("mmap: length=%zu\n", size);
+    MINIMK_TRACE_SYSCALL("mmap: prot=0x%x\n", CAST_U(prot));
+    MINIMK_TRACE_SYSCALL("mmap: flags=0x%x\n", CAST_U(flags));
+    MINIMK_TRACE_SYSCALL("mmap: fd=%d\n", -1);
+    MINIMK_TRACE_SYSCALL("mmap: offset=0x%x\n", 0U);
+    void *addr = M_sys_mmap(nullptr, size, prot, flags, -1, 0);
+    minimk_error_t mmap_res = (addr == MAP_FAILED) ? MINIMK_ENOMEM : 0;
+    MINIMK_TRACE_SYSCALL("mmap: result=%s\n", minimk_errno_name(mmap_res));
+    MINIMK_TRACE_SYSCALL("mmap: addr=%p\n", addr);
+    if (mmap_res != 0) {
+        return mmap_res;
+    }
+
+    // Return indicating success
+    *base = addr;
+    *mapped = size;
+    return 0;
+}
+
+/// Testable implementation of minimk_chunk_unmap
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(munmap) M_sys_munmap = munmap>
+MINIMK_ALWAYS_INLINE void minimk_chunk_unmap_impl(void *base, size_t size) noexcept {
+    M_minimk_syscall_clearerrno();
+    MINIMK_TRACE_SYSCALL("munmap: addr=%p\n", base);
+    MINIMK_TRACE_SYSCALL("munmap: length=%zu\n", size);
+    int rv = M_sys_munmap(base, size);
+    MINIMK_TRACE_SYSCALL("munmap: result=%s\n", (rv == -1) ? "failure" : "success");
+    (void)rv;
+}
+
+#endif // LIBMINIMK_CHUNK_CHUNK_LINUX_HPP
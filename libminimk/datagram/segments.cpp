@@ -0,0 +1,31 @@
+// File: libminimk/datagram/segments.cpp
+// Purpose: split UDP_GRO buffers into per-datagram views
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/cdefs.h>    // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/datagram.h> // for minimk_datagram_segments
+#include <minimk/iovec.h>    // for minimk_iovec_t
+
+#include <stddef.h> // for size_t
+
+size_t minimk_datagram_segments(void *data, size_t nread, size_t segment_size, minimk_iovec_t *views,
+                                size_t count) noexcept {
+    // Refuse to loop forever when there is no valid segment size
+    if (segment_size <= 0) {
+        return 0;
+    }
+
+    // Point each view at the next segment, with the last one possibly shorter
+    char *base = static_cast<char *>(data);
+    size_t nviews = 0;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t off = 0; off < nread && nviews < count;) {
+        size_t len = (nread - off < segment_size) ? nread - off : segment_size;
+        views[nviews].base = base + off;
+        views[nviews].len = len;
+        nviews++;
+        off += len; // cannot overflow since off + len <= nread
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return nviews;
+}
@@ -0,0 +1,243 @@
+// File: libminimk/iobuf/iobuf.cpp
+// Purpose: reference-counted buffer chains for zero-copy protocol layering
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pool.h" // for minimk_iobuf_block_alloc
+
+#include <minimk/cdefs.h> // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/iobuf.h> // for minimk_iobuf_t
+#include <minimk/iovec.h> // for minimk_iovec_t
+
+#include <stddef.h> // for size_t
+#include <string.h> // for memcpy
+
+// Ensure that a fresh block can hold the headroom and some payload.
+static_assert(MINIMK_IOBUF_HEADROOM < IOBUF_BLOCK_CAPACITY, "headroom must fit in a block");
+
+void minimk_iobuf_init(minimk_iobuf_t *buf) noexcept {
+    buf->head = nullptr;
+    buf->tail = nullptr;
+    buf->len = 0;
+    buf->nsegs = 0;
+}
+
+void minimk_iobuf_clear(minimk_iobuf_t *buf) noexcept {
+    while (buf->head != nullptr) {
+        minimk_iobuf_seg_t *seg = buf->head;
+        buf->head = seg->next;
+        minimk_iobuf_seg_free(seg);
+    }
+    minimk_iobuf_init(buf);
+}
+
+/// Link a segment at the end of the chain.
+static void minimk_iobuf_link_tail(minimk_iobuf_t *buf, minimk_iobuf_seg_t *seg) noexcept {
+    seg->next = nullptr;
+    if (buf->tail != nullptr) {
+        buf->tail->next = seg;
+    } else {
+        buf->head = seg;
+    }
+    buf->tail = seg;
+    buf->len += seg->len;
+    buf->nsegs++;
+}
+
+/// Unlink the first segment of a non-empty chain.
+static minimk_iobuf_seg_t *minimk_iobuf_unlink_head(minimk_iobuf_t *buf) noexcept {
+    minimk_iobuf_seg_t *seg = buf->head;
+    buf->head = seg->next;
+    if (buf->head == nullptr) {
+        buf->tail = nullptr;
+    }
+    buf->len -= seg->len;
+    buf->nsegs--;
+    seg->next = nullptr;
+    return seg;
+}
+
+/// Allocate a segment owning a new block whose handed-out range starts and ends at offset.
+static minimk_error_t minimk_iobuf_seg_alloc_with_block(minimk_iobuf_seg_t **pseg, size_t offset) noexcept {
+    minimk_error_t rv = minimk_iobuf_seg_alloc(pseg);
+    if (rv != 0) {
+        return rv;
+    }
+    rv = minimk_iobuf_block_alloc(&(*pseg)->block);
+    if (rv != 0) {
+        minimk_iobuf_seg_free(*pseg);
+        *pseg = nullptr;
+        return rv;
+    }
+    (*pseg)->block->start = offset;
+    (*pseg)->block->used = offset;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    (*pseg)->data = minimk_iobuf_block_data((*pseg)->block) + offset;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return 0;
+}
+
+minimk_error_t minimk_iobuf_append(minimk_iobuf_t *buf, const void *data, size_t count) noexcept {
+    if (count <= 0) {
+        return MINIMK_EINVAL;
+    }
+
+    const char *src = static_cast<const char *>(data);
+    while (count > 0) {
+        // We can grow the last segment when it owns the end of the handed-out range
+        minimk_iobuf_seg_t *tail = buf->tail;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        bool extensible = tail != nullptr && tail->block->used < IOBUF_BLOCK_CAPACITY &&
+                          tail->data + tail->len == minimk_iobuf_block_data(tail->block) + tail->block->used;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+
+        // Otherwise start a new block, leaving headroom when it is the first one
+        if (!extensible) {
+            minimk_iobuf_seg_t *seg = nullptr;
+            size_t offset = (buf->head == nullptr) ? MINIMK_IOBUF_HEADROOM : 0;
+            minimk_error_t rv = minimk_iobuf_seg_alloc_with_block(&seg, offset);
+            if (rv != 0) {
+                return rv;
+            }
+            minimk_iobuf_link_tail(buf, seg);
+            tail = seg;
+        }
+
+        size_t avail = IOBUF_BLOCK_CAPACITY - tail->block->used;
+        size_t amount = (count < avail) ? count : avail;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        memcpy(tail->data + tail->len, src, amount);
+        src += amount;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        tail->len += amount;
+        tail->block->used += amount;
+        buf->len += amount;
+        count -= amount;
+    }
+    return 0;
+}
+
+void minimk_iobuf_append_chain(minimk_iobuf_t *dst, minimk_iobuf_t *src) noexcept {
+    if (src->head == nullptr) {
+        return;
+    }
+    if (dst->tail != nullptr) {
+        dst->tail->next = src->head;
+    } else {
+        dst->head = src->head;
+    }
+    dst->tail = src->tail;
+    dst->len += src->len;
+    dst->nsegs += src->nsegs;
+    minimk_iobuf_init(src);
+}
+
+minimk_error_t minimk_iobuf_prepend(minimk_iobuf_t *buf, const void *data, size_t count) noexcept {
+    if (count <= 0 || count > IOBUF_BLOCK_CAPACITY) {
+        return MINIMK_EINVAL;
+    }
+
+    // We can grow the first segment when it owns the start of the handed-out range
+    minimk_iobuf_seg_t *head = buf->head;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    bool extensible = head != nullptr && head->block->start >= count &&
+                      head->data == minimk_iobuf_block_data(head->block) + head->block->start;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Otherwise fill a new block from its end, so later prepends find headroom
+    if (!extensible) {
+        minimk_iobuf_seg_t *seg = nullptr;
+        minimk_error_t rv = minimk_iobuf_seg_alloc_with_block(&seg, IOBUF_BLOCK_CAPACITY);
+        if (rv != 0) {
+            return rv;
+        }
+        seg->next = buf->head;
+        buf->head = seg;
+        if (buf->tail == nullptr) {
+            buf->tail = seg;
+        }
+        buf->nsegs++;
+        head = seg;
+    }
+
+    head->block->start -= count;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    head->data -= count;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    head->len += count;
+    buf->len += count;
+    memcpy(head->data, data, count);
+    return 0;
+}
+
+minimk_error_t minimk_iobuf_split(minimk_iobuf_t *buf, size_t count, minimk_iobuf_t *front) noexcept {
+    if (count > buf->len) {
+        return MINIMK_EINVAL;
+    }
+
+    while (count > 0) {
+        // Move whole segments without allocating
+        if (buf->head->len <= count) {
+            minimk_iobuf_seg_t *seg = minimk_iobuf_unlink_head(buf);
+            count -= seg->len;
+            minimk_iobuf_link_tail(front, seg);
+            continue;
+        }
+
+        // Share the block of a segment straddling the split point
+        minimk_iobuf_seg_t *seg = nullptr;
+        minimk_error_t rv = minimk_iobuf_seg_alloc(&seg);
+        if (rv != 0) {
+            return rv;
+        }
+        seg->block = buf->head->block;
+        seg->block->refcount++;
+        seg->data = buf->head->data;
+        seg->len = count;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        buf->head->data += count;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        buf->head->len -= count;
+        buf->len -= count;
+        minimk_iobuf_link_tail(front, seg);
+        count = 0;
+    }
+    return 0;
+}
+
+minimk_error_t minimk_iobuf_drop(minimk_iobuf_t *buf, size_t count) noexcept {
+    if (count > buf->len) {
+        return MINIMK_EINVAL;
+    }
+
+    while (count > 0) {
+        // Release whole segments
+        if (buf->head->len <= count) {
+            minimk_iobuf_seg_t *seg = minimk_iobuf_unlink_head(buf);
+            count -= seg->len;
+            minimk_iobuf_seg_free(seg);
+            continue;
+        }
+
+        // Trim the segment straddling the drop point
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        buf->head->data += count;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        buf->head->len -= count;
+        buf->len -= count;
+        count = 0;
+    }
+    return 0;
+}
+
+size_t minimk_iobuf_export(const minimk_iobuf_t *buf, minimk_iovec_t *iov, size_t iovcnt) noexcept {
+    size_t idx = 0;
+    for (minimk_iobuf_seg_t *seg = buf->head; seg != nullptr && idx < iovcnt; seg = seg->next) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        iov[idx].base = seg->data;
+        iov[idx].len = seg->len;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        idx++;
+    }
+    return idx;
+}
@@ -0,0 +1,80 @@
+// File: libminimk/iobuf/pool.cpp
+// Purpose: block and segment pools backing iobuf chains
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "../slab/pool.hpp" // for minimk_slab_pool_for_size
+#include "pool.h"           // for struct minimk_iobuf_block
+
+#include <minimk/cdefs.h> // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/iobuf.h> // for minimk_iobuf_seg_t
+
+// Ensure that the payload of each block stays 8-byte aligned.
+static_assert(sizeof(struct minimk_iobuf_block) % 8 == 0, "block header must preserve alignment");
+
+// Ensure that blocks do not waste memory when rounded to their size class.
+static_assert(minimk_slab_class_size(MINIMK_IOBUF_BLOCK_SIZE) == MINIMK_IOBUF_BLOCK_SIZE,
+              "block size must be a size class");
+
+/// Return the pool of blocks.
+static struct minimk_slab_pool *minimk_iobuf_block_pool(void) noexcept {
+    return minimk_slab_pool_for_size<MINIMK_IOBUF_BLOCK_SIZE>();
+}
+
+/// Return the pool of segments.
+static struct minimk_slab_pool *minimk_iobuf_seg_pool(void) noexcept {
+    return minimk_slab_pool_for_size<sizeof(minimk_iobuf_seg_t)>();
+}
+
+minimk_error_t minimk_iobuf_block_alloc(struct minimk_iobuf_block **pblock) noexcept {
+    *pblock = nullptr;
+    void *obj = nullptr;
+    minimk_error_t rv = minimk_slab_pool_alloc(minimk_iobuf_block_pool(), &obj);
+    if (rv != 0) {
+        return rv;
+    }
+    auto block = static_cast<struct minimk_iobuf_block *>(obj);
+    block->refcount = 1;
+    block->padding = 0;
+    block->start = 0;
+    block->used = 0;
+    *pblock = block;
+    return 0;
+}
+
+char *minimk_iobuf_block_data(struct minimk_iobuf_block *block) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return static_cast<char *>(static_cast<void *>(block + 1));
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+void minimk_iobuf_block_unref(struct minimk_iobuf_block *block) noexcept {
+    if (--block->refcount > 0) {
+        return;
+    }
+    minimk_slab_pool_free(minimk_iobuf_block_pool(), block);
+}
+
+minimk_error_t minimk_iobuf_seg_alloc(minimk_iobuf_seg_t **pseg) noexcept {
+    *pseg = nullptr;
+    void *obj = nullptr;
+    minimk_error_t rv = minimk_slab_pool_alloc(minimk_iobuf_seg_pool(), &obj);
+    if (rv != 0) {
+        return rv;
+    }
+    auto seg = static_cast<minimk_iobuf_seg_t *>(obj);
+    seg->next = nullptr;
+    seg->block = nullptr;
+    seg->data = nullptr;
+    seg->len = 0;
+    *pseg = seg;
+    return 0;
+}
+
+void minimk_iobuf_seg_free(minimk_iobuf_seg_t *seg) noexcept {
+    if (seg->block != nullptr) {
+        minimk_iobuf_block_unref(seg->block);
+        seg->block = nullptr;
+    }
+    minimk_slab_pool_free(minimk_iobuf_seg_pool(), seg);
+}
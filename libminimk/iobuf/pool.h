@@ -0,0 +1,57 @@
+// File: libminimk/iobuf/pool.h
+// Purpose: block and segment pools backing iobuf chains
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_IOBUF_POOL_H
+#define LIBMINIMK_IOBUF_POOL_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/iobuf.h> // for minimk_iobuf_seg_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Header of a block, which the payload immediately follows.
+struct minimk_iobuf_block {
+    /// Number of segments referencing this block.
+    uint32_t refcount;
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+
+    /// Offset of the first payload byte handed out to a segment.
+    size_t start;
+
+    /// Offset one past the last payload byte handed out to a segment.
+    size_t used;
+};
+
+/// Number of payload bytes in each block.
+#define IOBUF_BLOCK_CAPACITY (MINIMK_IOBUF_BLOCK_SIZE - sizeof(struct minimk_iobuf_block))
+
+MINIMK_BEGIN_DECLS
+
+/// Take a block from the pool with a reference count of one.
+///
+/// The caller must initialize the start and used offsets.
+///
+/// We return MINIMK_ENOMEM when we cannot grow the pool.
+minimk_error_t minimk_iobuf_block_alloc(struct minimk_iobuf_block **pblock) MINIMK_NOEXCEPT;
+
+/// Return a pointer to the first payload byte of the block.
+char *minimk_iobuf_block_data(struct minimk_iobuf_block *block) MINIMK_NOEXCEPT;
+
+/// Drop a reference to the block, returning it to the pool on the last one.
+void minimk_iobuf_block_unref(struct minimk_iobuf_block *block) MINIMK_NOEXCEPT;
+
+/// Take a zero-initialized segment from the pool.
+///
+/// We return MINIMK_ENOMEM when we cannot grow the pool.
+minimk_error_t minimk_iobuf_seg_alloc(minimk_iobuf_seg_t **pseg) MINIMK_NOEXCEPT;
+
+/// Return a segment to the pool, dropping its block reference.
+void minimk_iobuf_seg_free(minimk_iobuf_seg_t *seg) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_IOBUF_POOL_H
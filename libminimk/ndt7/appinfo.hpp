@@ -0,0 +1,54 @@
+// File: libminimk/ndt7/appinfo.hpp
+// Purpose: AppInfo measurement message formatting
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_NDT7_APPINFO_HPP
+#define LIBMINIMK_NDT7_APPINFO_HPP
+
+#include <minimk/cdefs.h> // for MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+#include <string.h> // for memcpy, strlen
+
+/// Size of a buffer large enough for any AppInfo message.
+#define NDT7_APPINFO_SIZE static_cast<size_t>(125)
+
+/// Append the decimal representation of value to out and return its length.
+static inline size_t minimk_ndt7_format_uint(char *out, uint64_t value) noexcept {
+    char digits[20];
+    size_t count = 0;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    for (size_t idx = 0; idx < count; idx++) {
+        out[idx] = digits[count - idx - 1];
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return count;
+}
+
+/// Append the zero-terminated string to out and return its length.
+static inline size_t minimk_ndt7_format_string(char *out, const char *str) noexcept {
+    size_t count = strlen(str);
+    memcpy(out, str, count);
+    return count;
+}
+
+/// Format the AppInfo message into out, which holds NDT7_APPINFO_SIZE bytes.
+///
+/// The elapsed argument is in microseconds. We return the message length.
+static inline size_t minimk_ndt7_format_appinfo(char *out, uint64_t elapsed, uint64_t num_bytes) noexcept {
+    size_t len = 0;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    len += minimk_ndt7_format_string(out + len, "{\"AppInfo\":{\"ElapsedTime\":");
+    len += minimk_ndt7_format_uint(out + len, elapsed);
+    len += minimk_ndt7_format_string(out + len, ",\"NumBytes\":");
+    len += minimk_ndt7_format_uint(out + len, num_bytes);
+    len += minimk_ndt7_format_string(out + len, "}}");
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return len;
+}
+
+#endif // LIBMINIMK_NDT7_APPINFO_HPP
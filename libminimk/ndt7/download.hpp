@@ -0,0 +1,73 @@
+// File: libminimk/ndt7/download.hpp
+// Purpose: ndt7 download implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_NDT7_DOWNLOAD_HPP
+#define LIBMINIMK_NDT7_DOWNLOAD_HPP
+
+#include "session.h" // for minimk_ndt7_session_open
+
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ndt7.h>      // for minimk_ndt7_config_t
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+#include <minimk/websocket.h> // for minimk_websocket_read_header
+
+#include <stdint.h> // for uint64_t
+
+/// Testable minimk_ndt7_download implementation.
+template <decltype(minimk_ndt7_session_open) M_open = minimk_ndt7_session_open,
+          decltype(minimk_websocket_read_header) M_read_header = minimk_websocket_read_header,
+          decltype(minimk_ndt7_session_discard) M_discard = minimk_ndt7_session_discard,
+          decltype(minimk_ndt7_session_control) M_control = minimk_ndt7_session_control,
+          decltype(minimk_ndt7_session_send_small) M_send_small = minimk_ndt7_session_send_small,
+          decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_download_impl(const minimk_ndt7_config_t *config,
+                                                              const char *path,
+                                                              minimk_ndt7_measurement_t *result) noexcept {
+    *result = {};
+    struct minimk_ndt7_session session;
+    minimk_error_t rv = M_open(&session, config, path);
+    if (rv != 0) {
+        return rv;
+    }
+
+    // The server decides when the test ends, but do not wait forever
+    uint64_t deadline = session.start + session.duration + session.duration / 2;
+    for (bool closed = false; !closed;) {
+        minimk_websocket_frame_t frame = {};
+        rv = M_read_header(&session.reader, &frame);
+        if (rv != 0) {
+            break;
+        }
+
+        switch (frame.opcode) {
+        case MINIMK_WEBSOCKET_OPCODE_PING:
+        case MINIMK_WEBSOCKET_OPCODE_PONG:
+        case MINIMK_WEBSOCKET_OPCODE_CLOSE:
+            rv = M_control(&session, &frame, &closed);
+            break;
+
+        default:
+            // Count both the binary messages and the server measurements
+            rv = M_discard(&session, frame.length, true);
+            break;
+        }
+        if (rv != 0) {
+            break;
+        }
+
+        // Close ourselves when the server overstays the deadline
+        if (!closed && M_now() >= deadline) {
+            rv = M_send_small(&session, MINIMK_WEBSOCKET_OPCODE_CLOSE, NDT7_CLOSE_NORMAL, 2);
+            break;
+        }
+    }
+    if (rv == MINIMK_EOF) {
+        rv = 0;
+    }
+
+    minimk_ndt7_session_close(&session, result);
+    return rv;
+}
+
+#endif // LIBMINIMK_NDT7_DOWNLOAD_HPP
@@ -0,0 +1,63 @@
+// File: libminimk/ndt7/session.cpp
+// Purpose: ndt7 session implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "session.h"   // for struct minimk_ndt7_session
+#include "session.hpp" // for minimk_ndt7_session_open_impl
+
+#include <minimk/arena.h>     // for minimk_arena_destroy
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ndt7.h>      // for minimk_ndt7_config_t
+#include <minimk/socket.h>    // for minimk_socket_destroy
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t, uint64_t
+
+minimk_error_t minimk_ndt7_session_open(struct minimk_ndt7_session *session,
+                                        const minimk_ndt7_config_t *config, const char *path) noexcept {
+    return minimk_ndt7_session_open_impl(session, config, path);
+}
+
+void minimk_ndt7_session_close(struct minimk_ndt7_session *session,
+                               minimk_ndt7_measurement_t *result) noexcept {
+    if (result != nullptr) {
+        session->measurement.elapsed = (minimk_time_monotonic_now() - session->start) / 1000;
+        if (minimk_socket_get_tcpinfo(session->sock, &session->measurement.tcpinfo) != 0) {
+            session->measurement.tcpinfo = {};
+        }
+        *result = session->measurement;
+    }
+    (void)minimk_socket_destroy(&session->sock);
+    minimk_arena_destroy(&session->arena);
+}
+
+uint64_t minimk_ndt7_session_random(struct minimk_ndt7_session *session) noexcept {
+    // Use xorshift64*, which is fast and good enough for masks and payloads
+    uint64_t state = session->rng;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    session->rng = state;
+    return state * static_cast<uint64_t>(0x2545f4914f6cdd1d);
+}
+
+minimk_error_t minimk_ndt7_session_send_small(struct minimk_ndt7_session *session, uint32_t opcode,
+                                              const void *data, size_t count) noexcept {
+    return minimk_ndt7_session_send_small_impl(session, opcode, data, count);
+}
+
+minimk_error_t minimk_ndt7_session_maybe_emit(struct minimk_ndt7_session *session, uint64_t now) noexcept {
+    return minimk_ndt7_session_maybe_emit_impl(session, now);
+}
+
+minimk_error_t minimk_ndt7_session_discard(struct minimk_ndt7_session *session, uint64_t count,
+                                           bool count_bytes) noexcept {
+    return minimk_ndt7_session_discard_impl(session, count, count_bytes);
+}
+
+minimk_error_t minimk_ndt7_session_control(struct minimk_ndt7_session *session,
+                                           const minimk_websocket_frame_t *frame, bool *closed) noexcept {
+    return minimk_ndt7_session_control_impl(session, frame, closed);
+}
@@ -0,0 +1,116 @@
+// File: libminimk/ndt7/session.h
+// Purpose: state shared by the ndt7 download and upload tests
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_NDT7_SESSION_H
+#define LIBMINIMK_NDT7_SESSION_H
+
+#include <minimk/arena.h>     // for minimk_arena_t
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/cdefs.h>     // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ndt7.h>      // for minimk_ndt7_config_t
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+/// Size of the receive ring, large enough to drain the socket in few recvs.
+#define NDT7_RING_SIZE (static_cast<size_t>(1) << 20)
+
+/// Size of the buffer we compose the upgrade request into.
+#define NDT7_WRITER_SIZE static_cast<size_t>(4096)
+
+/// Alignment of the buffers we allocate from the arena.
+#define NDT7_BUFFER_ALIGN static_cast<size_t>(64)
+
+/// Read and write timeout in nanoseconds, as recommended by the ndt7 specification.
+#define NDT7_IO_TIMEOUT static_cast<uint64_t>(7000000000)
+
+/// Close frame payload carrying the normal closure status code 1000.
+#define NDT7_CLOSE_NORMAL "\x03\xe8"
+
+/// Connection to an ndt7 server along with the measurement state.
+struct minimk_ndt7_session {
+    /// Socket connected to the server.
+    minimk_socket_t sock;
+
+    /// Buffered reader over sock.
+    minimk_bufreader_t reader;
+
+    /// Buffered writer over sock, which we only use for the handshake.
+    minimk_bufwriter_t writer;
+
+    /// Arena owning the buffers, which we destroy with the session.
+    minimk_arena_t arena;
+
+    /// Callback and opaque pointer from the configuration.
+    void (*callback)(void *opaque, const minimk_ndt7_measurement_t *measurement);
+    void *opaque;
+
+    /// Monotonic time in nanoseconds when the test started.
+    uint64_t start;
+
+    /// Test duration in nanoseconds.
+    uint64_t duration;
+
+    /// Interval between measurements in nanoseconds.
+    uint64_t interval;
+
+    /// Monotonic time in nanoseconds of the next measurement.
+    uint64_t next_emit;
+
+    /// State of the pseudorandom generator.
+    uint64_t rng;
+
+    /// Most recent measurement.
+    minimk_ndt7_measurement_t measurement;
+};
+
+MINIMK_BEGIN_DECLS
+
+/// Connect to the server, allocate the buffers, and perform the WebSocket upgrade.
+///
+/// On failure, the session is already closed.
+minimk_error_t minimk_ndt7_session_open(struct minimk_ndt7_session *session,
+                                        const minimk_ndt7_config_t *config, const char *path) MINIMK_NOEXCEPT;
+
+/// Close the socket and release the buffers.
+///
+/// When result is not NULL, we first take the final measurement into it.
+void minimk_ndt7_session_close(struct minimk_ndt7_session *session,
+                               minimk_ndt7_measurement_t *result) MINIMK_NOEXCEPT;
+
+/// Return the next pseudorandom number, which we use for nonces, masking keys, and payloads.
+uint64_t minimk_ndt7_session_random(struct minimk_ndt7_session *session) MINIMK_NOEXCEPT;
+
+/// Send a small masked frame of at most 125 bytes, such as a control frame.
+minimk_error_t minimk_ndt7_session_send_small(struct minimk_ndt7_session *session, uint32_t opcode,
+                                              const void *data, size_t count) MINIMK_NOEXCEPT;
+
+/// Take a measurement when the interval has elapsed at now.
+///
+/// We pass the measurement to the callback and send it to the server as
+/// an AppInfo text message.
+minimk_error_t minimk_ndt7_session_maybe_emit(struct minimk_ndt7_session *session,
+                                              uint64_t now) MINIMK_NOEXCEPT;
+
+/// Discard count payload bytes from the reader.
+///
+/// When count_bytes is true, we account them in the measurement and take
+/// measurements while waiting for a large payload to arrive.
+minimk_error_t minimk_ndt7_session_discard(struct minimk_ndt7_session *session, uint64_t count,
+                                           bool count_bytes) MINIMK_NOEXCEPT;
+
+/// Handle a ping, pong, or close frame whose header we just read.
+///
+/// We answer pings with pongs and a close with a close. On return, closed
+/// tells whether the server has closed the WebSocket connection.
+minimk_error_t minimk_ndt7_session_control(struct minimk_ndt7_session *session,
+                                           const minimk_websocket_frame_t *frame,
+                                           bool *closed) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_NDT7_SESSION_H
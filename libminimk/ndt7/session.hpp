@@ -0,0 +1,218 @@
+// File: libminimk/ndt7/session.hpp
+// Purpose: ndt7 session implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_NDT7_SESSION_HPP
+#define LIBMINIMK_NDT7_SESSION_HPP
+
+#include "appinfo.hpp" // for minimk_ndt7_format_appinfo
+#include "session.h"   // for struct minimk_ndt7_session
+
+#include <minimk/arena.h>     // for minimk_arena_alloc
+#include <minimk/bufreader.h> // for minimk_bufreader_peek
+#include <minimk/bufwriter.h> // for minimk_bufwriter_init
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/ndt7.h>      // for minimk_ndt7_config_t
+#include <minimk/socket.h>    // for minimk_socket_create
+#include <minimk/syscall.h>   // for minimk_syscall_af_inet
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+#include <minimk/websocket.h> // for minimk_websocket_client_handshake
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint8_t, uint32_t, uint64_t
+#include <string.h> // for memcpy, strchr
+
+/// Maximum payload size of a control frame.
+#define NDT7_CONTROL_MAX static_cast<size_t>(125)
+
+/// Testable minimk_ndt7_session_open implementation.
+template <decltype(minimk_socket_create) M_create = minimk_socket_create,
+          decltype(minimk_socket_set_read_timeout) M_set_read_timeout = minimk_socket_set_read_timeout,
+          decltype(minimk_socket_set_write_timeout) M_set_write_timeout = minimk_socket_set_write_timeout,
+          decltype(minimk_socket_connect) M_connect = minimk_socket_connect,
+          decltype(minimk_arena_alloc) M_alloc = minimk_arena_alloc,
+          decltype(minimk_websocket_client_handshake) M_handshake = minimk_websocket_client_handshake,
+          decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_session_open_impl(struct minimk_ndt7_session *session,
+                                                                  const minimk_ndt7_config_t *config,
+                                                                  const char *path) noexcept {
+    *session = {};
+    session->sock = MINIMK_SOCKET_INVALID;
+    minimk_arena_init(&session->arena, 0);
+    session->callback = config->callback;
+    session->opaque = config->opaque;
+    session->duration = config->duration > 0 ? config->duration : MINIMK_NDT7_DEFAULT_DURATION;
+    session->interval = config->interval > 0 ? config->interval : MINIMK_NDT7_DEFAULT_INTERVAL;
+
+    // Seed the generator, which must never be zero, from the clock
+    session->rng = M_now() ^ static_cast<uint64_t>(0x9e3779b97f4a7c15);
+    session->rng = session->rng != 0 ? session->rng : 1;
+
+    // Connect to the server using the family of its numeric address
+    int domain = strchr(config->address, ':') != nullptr ? minimk_syscall_af_inet6 : minimk_syscall_af_inet;
+    minimk_error_t rv = M_create(&session->sock, domain, minimk_syscall_sock_stream, 0);
+    if (rv == 0) {
+        rv = M_set_read_timeout(session->sock, NDT7_IO_TIMEOUT);
+    }
+    if (rv == 0) {
+        rv = M_set_write_timeout(session->sock, NDT7_IO_TIMEOUT);
+    }
+    if (rv == 0) {
+        rv = M_connect(session->sock, config->address, config->port);
+    }
+
+    // Allocate all the buffers we need upfront
+    void *ring = nullptr;
+    void *wbuf = nullptr;
+    if (rv == 0) {
+        rv = M_alloc(&session->arena, NDT7_RING_SIZE, NDT7_BUFFER_ALIGN, &ring);
+    }
+    if (rv == 0) {
+        rv = M_alloc(&session->arena, NDT7_WRITER_SIZE, NDT7_BUFFER_ALIGN, &wbuf);
+    }
+    if (rv == 0) {
+        rv = minimk_bufreader_init(&session->reader, session->sock, ring, NDT7_RING_SIZE);
+    }
+    if (rv == 0) {
+        rv = minimk_bufwriter_init(&session->writer, session->sock, wbuf, NDT7_WRITER_SIZE);
+    }
+
+    // Upgrade to WebSocket using a fresh nonce
+    if (rv == 0) {
+        uint8_t nonce[16];
+        uint64_t words[2] = {minimk_ndt7_session_random(session), minimk_ndt7_session_random(session)};
+        memcpy(nonce, words, sizeof(nonce));
+        rv = M_handshake(&session->reader, &session->writer, config->host, path, MINIMK_NDT7_PROTOCOL, nonce);
+    }
+    if (rv != 0) {
+        minimk_ndt7_session_close(session, nullptr);
+        return rv;
+    }
+
+    // Start the clock only once the connection is ready
+    session->start = M_now();
+    session->next_emit = session->start + session->interval;
+    return 0;
+}
+
+/// Testable minimk_ndt7_session_send_small implementation.
+template <decltype(minimk_websocket_send_frame) M_send_frame = minimk_websocket_send_frame>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_session_send_small_impl(struct minimk_ndt7_session *session,
+                                                                        uint32_t opcode, const void *data,
+                                                                        size_t count) noexcept {
+    if (count > NDT7_CONTROL_MAX) {
+        return MINIMK_EINVAL;
+    }
+
+    // Clients must mask, so mask a copy and leave the caller's data alone
+    char payload[NDT7_CONTROL_MAX];
+    if (count > 0) {
+        memcpy(payload, data, count);
+    }
+    minimk_websocket_frame_t frame = {};
+    frame.length = count;
+    frame.opcode = opcode;
+    frame.flags = MINIMK_WEBSOCKET_FLAG_FIN | MINIMK_WEBSOCKET_FLAG_MASK;
+    frame.maskkey = static_cast<uint32_t>(minimk_ndt7_session_random(session));
+    minimk_websocket_mask(payload, count, frame.maskkey, 0);
+    return M_send_frame(session->sock, &frame, payload);
+}
+
+/// Testable minimk_ndt7_session_maybe_emit implementation.
+template <decltype(minimk_socket_get_tcpinfo) M_get_tcpinfo = minimk_socket_get_tcpinfo,
+          decltype(minimk_ndt7_session_send_small) M_send_small = minimk_ndt7_session_send_small>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_session_maybe_emit_impl(struct minimk_ndt7_session *session,
+                                                                        uint64_t now) noexcept {
+    if (now < session->next_emit) {
+        return 0;
+    }
+    session->next_emit = now + session->interval;
+
+    // Fill the measurement, leaving the kernel statistics zero when unavailable
+    minimk_ndt7_measurement_t *measurement = &session->measurement;
+    measurement->elapsed = (now - session->start) / 1000;
+    if (M_get_tcpinfo(session->sock, &measurement->tcpinfo) != 0) {
+        measurement->tcpinfo = {};
+    }
+    if (session->callback != nullptr) {
+        session->callback(session->opaque, measurement);
+    }
+
+    // Tell the server what we have measured
+    char message[NDT7_APPINFO_SIZE];
+    size_t len = minimk_ndt7_format_appinfo(message, measurement->elapsed, measurement->num_bytes);
+    return M_send_small(session, MINIMK_WEBSOCKET_OPCODE_TEXT, message, len);
+}
+
+/// Testable minimk_ndt7_session_discard implementation.
+template <decltype(minimk_bufreader_peek) M_peek = minimk_bufreader_peek,
+          decltype(minimk_ndt7_session_maybe_emit) M_maybe_emit = minimk_ndt7_session_maybe_emit,
+          decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_session_discard_impl(struct minimk_ndt7_session *session,
+                                                                     uint64_t count,
+                                                                     bool count_bytes) noexcept {
+    // Consume the payload in place, at most one recv per iteration
+    while (count > 0) {
+        minimk_iovec_t view = {};
+        minimk_error_t rv = M_peek(&session->reader, &view);
+        if (rv != 0) {
+            return rv;
+        }
+        size_t amount = view.len < count ? view.len : static_cast<size_t>(count);
+        (void)minimk_bufreader_consume(&session->reader, amount);
+        count -= amount;
+        if (!count_bytes) {
+            continue;
+        }
+
+        // Keep measuring while a large message trickles in
+        session->measurement.num_bytes += amount;
+        rv = M_maybe_emit(session, M_now());
+        if (rv != 0) {
+            return rv;
+        }
+    }
+    return 0;
+}
+
+/// Testable minimk_ndt7_session_control implementation.
+template <decltype(minimk_bufreader_read) M_read = minimk_bufreader_read,
+          decltype(minimk_ndt7_session_send_small) M_send_small = minimk_ndt7_session_send_small>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_session_control_impl(struct minimk_ndt7_session *session,
+                                                                     const minimk_websocket_frame_t *frame,
+                                                                     bool *closed) noexcept {
+    *closed = false;
+
+    // Read the whole payload, which read_header guarantees is small
+    char payload[NDT7_CONTROL_MAX];
+    size_t count = static_cast<size_t>(frame->length);
+    for (size_t off = 0; off < count;) {
+        size_t nread = 0;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        minimk_error_t rv = M_read(&session->reader, payload + off, count - off, &nread);
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        if (rv != 0) {
+            return rv;
+        }
+        off += nread;
+    }
+    if ((frame->flags & MINIMK_WEBSOCKET_FLAG_MASK) != 0) {
+        minimk_websocket_mask(payload, count, frame->maskkey, 0);
+    }
+
+    // Answer pings with the same data and echo the close status code
+    switch (frame->opcode) {
+    case MINIMK_WEBSOCKET_OPCODE_PING:
+        return M_send_small(session, MINIMK_WEBSOCKET_OPCODE_PONG, payload, count);
+
+    case MINIMK_WEBSOCKET_OPCODE_CLOSE:
+        *closed = true;
+        return M_send_small(session, MINIMK_WEBSOCKET_OPCODE_CLOSE, payload, count < 2 ? count : 2);
+
+    default:
+        return 0;
+    }
+}
+
+#endif // LIBMINIMK_NDT7_SESSION_HPP
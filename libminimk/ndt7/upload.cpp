@@ -0,0 +1,13 @@
+// File: libminimk/ndt7/upload.cpp
+// Purpose: ndt7 upload implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "upload.hpp" // for minimk_ndt7_upload_impl
+
+#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/ndt7.h>  // for minimk_ndt7_config_t
+
+minimk_error_t minimk_ndt7_upload(const minimk_ndt7_config_t *config, const char *path,
+                                  minimk_ndt7_measurement_t *result) noexcept {
+    return minimk_ndt7_upload_impl(config, path, result);
+}
@@ -0,0 +1,115 @@
+// File: libminimk/ndt7/upload.hpp
+// Purpose: ndt7 upload implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_NDT7_UPLOAD_HPP
+#define LIBMINIMK_NDT7_UPLOAD_HPP
+
+#include "session.h" // for minimk_ndt7_session_open
+
+#include <minimk/arena.h>     // for minimk_arena_alloc
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ndt7.h>      // for minimk_ndt7_config_t
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+#include <minimk/websocket.h> // for minimk_websocket_send_frame
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t, uint64_t
+
+/// Size of the first message, as the ndt7 specification suggests.
+#define NDT7_MIN_MESSAGE_SIZE (static_cast<size_t>(1) << 13)
+
+/// Size of the largest message, which is also the size of the random buffer.
+#define NDT7_MAX_MESSAGE_SIZE (static_cast<size_t>(1) << 24)
+
+/// We double the message size while it is smaller than this fraction of the bytes sent.
+#define NDT7_SCALING_FRACTION 16
+
+/// Testable minimk_ndt7_upload implementation.
+template <decltype(minimk_ndt7_session_open) M_open = minimk_ndt7_session_open,
+          decltype(minimk_arena_alloc) M_alloc = minimk_arena_alloc,
+          decltype(minimk_websocket_send_frame) M_send_frame = minimk_websocket_send_frame,
+          decltype(minimk_ndt7_session_maybe_emit) M_maybe_emit = minimk_ndt7_session_maybe_emit,
+          decltype(minimk_ndt7_session_send_small) M_send_small = minimk_ndt7_session_send_small,
+          decltype(minimk_websocket_read_header) M_read_header = minimk_websocket_read_header,
+          decltype(minimk_ndt7_session_discard) M_discard = minimk_ndt7_session_discard,
+          decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ndt7_upload_impl(const minimk_ndt7_config_t *config,
+                                                            const char *path,
+                                                            minimk_ndt7_measurement_t *result) noexcept {
+    *result = {};
+    struct minimk_ndt7_session session;
+    minimk_error_t rv = M_open(&session, config, path);
+    if (rv != 0) {
+        return rv;
+    }
+
+    // Prepare the random data of the largest message once
+    void *payload = nullptr;
+    rv = M_alloc(&session.arena, NDT7_MAX_MESSAGE_SIZE, NDT7_BUFFER_ALIGN, &payload);
+    if (rv != 0) {
+        minimk_ndt7_session_close(&session, nullptr);
+        return rv;
+    }
+    uint64_t *words = static_cast<uint64_t *>(payload);
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < NDT7_MAX_MESSAGE_SIZE / sizeof(uint64_t); idx++) {
+        words[idx] = minimk_ndt7_session_random(&session);
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Send messages until the deadline, growing them with the bytes sent.
+    //
+    // We use a fresh masking key for each message but send the payload
+    // without XORing it, which the server unmasks into different but still
+    // random bytes, so we never touch the payload on the hot path.
+    uint64_t deadline = session.start + session.duration;
+    size_t size = NDT7_MIN_MESSAGE_SIZE;
+    for (;;) {
+        uint64_t now = M_now();
+        if (now >= deadline) {
+            break;
+        }
+        rv = M_maybe_emit(&session, now);
+        if (rv != 0) {
+            break;
+        }
+
+        minimk_websocket_frame_t frame = {};
+        frame.length = size;
+        frame.opcode = MINIMK_WEBSOCKET_OPCODE_BINARY;
+        frame.flags = MINIMK_WEBSOCKET_FLAG_FIN | MINIMK_WEBSOCKET_FLAG_MASK;
+        frame.maskkey = static_cast<uint32_t>(minimk_ndt7_session_random(&session));
+        rv = M_send_frame(session.sock, &frame, payload);
+        if (rv != 0) {
+            break;
+        }
+        session.measurement.num_bytes += size;
+        if (size < NDT7_MAX_MESSAGE_SIZE && size < session.measurement.num_bytes / NDT7_SCALING_FRACTION) {
+            size *= 2;
+        }
+    }
+
+    // Close and drain the server measurements until it confirms
+    if (rv == 0) {
+        rv = M_send_small(&session, MINIMK_WEBSOCKET_OPCODE_CLOSE, NDT7_CLOSE_NORMAL, 2);
+    }
+    for (bool closed = false; rv == 0 && !closed;) {
+        minimk_websocket_frame_t frame = {};
+        rv = M_read_header(&session.reader, &frame);
+        if (rv != 0) {
+            break;
+        }
+        // We must not send anything after our close frame, so ignore pings
+        closed = frame.opcode == MINIMK_WEBSOCKET_OPCODE_CLOSE;
+        rv = M_discard(&session, frame.length, false);
+    }
+    if (rv == MINIMK_EOF) {
+        rv = 0;
+    }
+
+    minimk_ndt7_session_close(&session, result);
+    return rv;
+}
+
+#endif // LIBMINIMK_NDT7_UPLOAD_HPP
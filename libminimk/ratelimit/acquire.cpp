@@ -0,0 +1,15 @@
+// File: libminimk/ratelimit/acquire.cpp
+// Purpose: acquire implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "acquire.hpp" // for minimk_ratelimit_acquire_impl
+
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_ratelimit_acquire(minimk_ratelimit_t *limit, size_t want, size_t atleast,
+                                        size_t *granted) noexcept {
+    return minimk_ratelimit_acquire_impl(limit, want, atleast, granted);
+}
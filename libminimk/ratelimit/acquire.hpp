@@ -0,0 +1,46 @@
+// File: libminimk/ratelimit/acquire.hpp
+// Purpose: acquire implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RATELIMIT_ACQUIRE_HPP
+#define LIBMINIMK_RATELIMIT_ACQUIRE_HPP
+
+#include "refill.hpp" // for minimk_ratelimit_refill
+
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/runtime.h>   // for minimk_runtime_nanosleep
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+/// Testable minimk_ratelimit_acquire implementation.
+template <decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now,
+          decltype(minimk_runtime_nanosleep) M_nanosleep = minimk_runtime_nanosleep>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_ratelimit_acquire_impl(minimk_ratelimit_t *limit, size_t want,
+                                                                  size_t atleast, size_t *granted) noexcept {
+    *granted = 0;
+    if (atleast <= 0 || atleast > want || atleast > limit->burst) {
+        return MINIMK_EINVAL;
+    }
+
+    for (;;) {
+        // Take as many tokens as we can once there are enough
+        minimk_ratelimit_refill(limit, M_now());
+        if (limit->tokens >= atleast) {
+            uint64_t amount = (want < limit->tokens) ? want : limit->tokens;
+            limit->tokens -= amount;
+            *granted = static_cast<size_t>(amount);
+            return 0;
+        }
+
+        // Sleep on the timer until the missing tokens accumulate
+        uint64_t need = atleast - limit->tokens;
+        uint64_t wait = (need / limit->rate) * RATELIMIT_NANOSEC_PER_SEC +
+                        ((need % limit->rate) * RATELIMIT_NANOSEC_PER_SEC + limit->rate - 1) / limit->rate;
+        M_nanosleep(wait);
+    }
+}
+
+#endif // LIBMINIMK_RATELIMIT_ACQUIRE_HPP
@@ -0,0 +1,34 @@
+// File: libminimk/ratelimit/ratelimit.cpp
+// Purpose: token-bucket rate limiter initialization, quantum, and refunds
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "refill.hpp" // for RATELIMIT_NANOSEC_PER_SEC
+
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/time.h>      // for minimk_time_monotonic_now
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t, UINT64_MAX
+
+minimk_error_t minimk_ratelimit_init(minimk_ratelimit_t *limit, uint64_t rate, uint64_t burst) noexcept {
+    // Keep rate * (10^9 + 1) within 64 bits for the refill and wait arithmetic
+    if (rate <= 0 || burst <= 0 || rate > UINT64_MAX / (RATELIMIT_NANOSEC_PER_SEC + 1)) {
+        return MINIMK_EINVAL;
+    }
+    limit->rate = rate;
+    limit->burst = burst;
+    limit->tokens = burst;
+    limit->last = minimk_time_monotonic_now();
+    return 0;
+}
+
+size_t minimk_ratelimit_quantum(const minimk_ratelimit_t *limit, size_t want) noexcept {
+    size_t quantum = (want < MINIMK_RATELIMIT_QUANTUM) ? want : MINIMK_RATELIMIT_QUANTUM;
+    return (quantum < limit->burst) ? quantum : static_cast<size_t>(limit->burst);
+}
+
+void minimk_ratelimit_refund(minimk_ratelimit_t *limit, size_t count) noexcept {
+    uint64_t room = limit->burst - limit->tokens;
+    limit->tokens += (count < room) ? count : room;
+}
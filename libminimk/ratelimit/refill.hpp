@@ -0,0 +1,53 @@
+// File: libminimk/ratelimit/refill.hpp
+// Purpose: token-bucket refill arithmetic
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RATELIMIT_REFILL_HPP
+#define LIBMINIMK_RATELIMIT_REFILL_HPP
+
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+
+#include <stdint.h> // for uint64_t
+
+/// Number of nanoseconds in a second.
+#define RATELIMIT_NANOSEC_PER_SEC static_cast<uint64_t>(1000000000)
+
+/// Add the tokens accumulated between the last refill and now.
+///
+/// We only advance the last refill time by the time needed to produce the
+/// whole tokens we added, so frequent refills at low rates do not lose the
+/// fractional tokens. We split the arithmetic into whole seconds and
+/// remainder to avoid overflowing 64 bits.
+static inline void minimk_ratelimit_refill(minimk_ratelimit_t *limit, uint64_t now) noexcept {
+    if (now <= limit->last) {
+        return;
+    }
+    if (limit->tokens >= limit->burst) {
+        limit->last = now;
+        return;
+    }
+
+    // Fill the bucket when enough whole seconds have elapsed
+    uint64_t elapsed = now - limit->last;
+    uint64_t missing = limit->burst - limit->tokens;
+    uint64_t secs = elapsed / RATELIMIT_NANOSEC_PER_SEC;
+    uint64_t rem = elapsed % RATELIMIT_NANOSEC_PER_SEC;
+    uint64_t secs_to_fill = missing / limit->rate + ((missing % limit->rate) != 0 ? 1 : 0);
+    if (secs >= secs_to_fill) {
+        limit->tokens = limit->burst;
+        limit->last = now;
+        return;
+    }
+
+    uint64_t added = secs * limit->rate + (rem * limit->rate) / RATELIMIT_NANOSEC_PER_SEC;
+    if (added >= missing) {
+        limit->tokens = limit->burst;
+        limit->last = now;
+        return;
+    }
+
+    limit->tokens += added;
+    limit->last += (added / limit->rate) * RATELIMIT_NANOSEC_PER_SEC +
+                   ((added % limit->rate) * RATELIMIT_NANOSEC_PER_SEC) / limit->rate;
+}
+
+#endif // LIBMINIMK_RATELIMIT_REFILL_HPP
@@ -45,6 +45,14 @@ minimk_error_t minimk_runtime_coroutine_resume_io(struct coroutine *coro, minimk
     return minimk_runtime_coroutine_resume_io_impl(coro, sock, events);
 }
 
+void minimk_runtime_coroutine_suspend_sync(struct coroutine *coro) noexcept {
+    minimk_runtime_coroutine_suspend_sync_impl(coro);
+}
+
+void minimk_runtime_coroutine_wakeup_sync(struct coroutine *coro) noexcept {
+    minimk_runtime_coroutine_wakeup_sync_impl(coro);
+}
+
 void minimk_runtime_coroutine_mark_as_exited(struct coroutine *coro) noexcept {
     minimk_runtime_coroutine_mark_as_exited_impl(coro);
 }
@@ -27,6 +27,12 @@
 /// Coroutine is blocked awaiting for a socket.
 #define CORO_BLOCKED_ON_IO 4
 
+/// Coroutine is blocked awaiting for a synchronization primitive.
+#define CORO_BLOCKED_ON_SYNC 5
+
+/// Maximum number of coroutine-local storage keys.
+#define MAX_LOCALS 8
+
 /// Portable coroutine state.
 ///
 /// We align this structure to safely memset it to zero on arm64.
@@ -50,6 +56,13 @@ struct coroutine {
     short events;
     short revents;
 
+    /// Links used when the coroutine is suspended in a waitlist.
+    struct coroutine *prev;
+    struct coroutine *next;
+
+    /// Coroutine-local storage values indexed by key.
+    void *locals[MAX_LOCALS];
+
 } __attribute__((aligned(16)));
 
 // Forward declaration of the coroutine scheduler.
@@ -102,6 +115,12 @@ void minimk_runtime_coroutine_suspend_io(struct coroutine *coro, minimk_syscall_
 minimk_error_t minimk_runtime_coroutine_resume_io(struct coroutine *coro, minimk_syscall_socket_t sock,
                                                   short events) MINIMK_NOEXCEPT;
 
+/// Parks the coroutine until another coroutine wakes it up.
+void minimk_runtime_coroutine_suspend_sync(struct coroutine *coro) MINIMK_NOEXCEPT;
+
+/// Makes runnable a coroutine suspended on a synchronization primitive.
+void minimk_runtime_coroutine_wakeup_sync(struct coroutine *coro) MINIMK_NOEXCEPT;
+
 /// Mark the coroutine as EXITED so the scheduler will not attempt to
 /// resume it and will free it later on as part of its loop.
 void minimk_runtime_coroutine_mark_as_exited(struct coroutine *coro) MINIMK_NOEXCEPT;
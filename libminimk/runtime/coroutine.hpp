@@ -8,6 +8,7 @@
 #include "../integer/u64.h"   // for minimk_integer_u64_satadd
 
 #include "coroutine.h" // for struct coroutine
+#include "locals.h"    // for minimk_runtime_locals_destroy
 #include "stack.h"     // for minimk_runtime_stack_alloc
 #include "switch.h"    // for minimk_runtime_init_coro_stack
 
@@ -61,8 +62,12 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_coroutine_init_impl(struct co
 }
 
 /// Testable implementation of minimk_runtime_coroutine_finish.
-template <decltype(minimk_runtime_stack_free) M_stack_free = minimk_runtime_stack_free>
+template <decltype(minimk_runtime_locals_destroy) M_locals_destroy = minimk_runtime_locals_destroy,
+          decltype(minimk_runtime_stack_free) M_stack_free = minimk_runtime_stack_free>
 MINIMK_ALWAYS_INLINE void minimk_runtime_coroutine_finish_impl(struct coroutine *coro) noexcept {
+    // Destroy the coroutine-local storage values
+    M_locals_destroy(coro);
+
     // Delete the coroutine stack
     auto stack = &coro->stack;
     MINIMK_TRACE_COROUTINE("%p free_stack\n", CAST_VOID_P(coro));
@@ -87,8 +92,11 @@ static inline void minimk_runtime_coroutine_maybe_resume_impl(struct coroutine *
         return;
     }
 
-    // Compute whether the coroutine was blocked on I/O and needs to be resumed
-    if (coro->state == CORO_BLOCKED_ON_IO && ((coro->events & revents) != 0 || now >= coro->deadline)) {
+    // Compute whether the coroutine was blocked on I/O and needs to be resumed. Note that
+    // we also resume on error or hangup, so the I/O operation can retry and see the error.
+    short interest = static_cast<short>(coro->events | minimk_syscall_pollerr | minimk_syscall_pollhup);
+    if (coro->state == CORO_BLOCKED_ON_IO && ((interest & revents) != 0 || now >= coro->deadline)) {
+        MINIMK_ASSERT(coro->prev == nullptr && coro->next == nullptr);
         MINIMK_TRACE_COROUTINE("%p BLOCKED_ON_IO -> RUNNABLE\n", CAST_VOID_P(coro));
         coro->deadline = 0;
         coro->state = CORO_RUNNABLE;
@@ -173,9 +181,9 @@ static inline minimk_error_t minimk_runtime_coroutine_resume_io_impl(struct coro
         return 0;
     }
 
-    // We also have some kind of success if there is an error in the sense that
-    // the caller should retry the I/O operation to get the error.
-    if ((revents & minimk_syscall_pollerr) != 0) {
+    // We also have some kind of success if there is an error or hangup in the sense
+    // that the caller should retry the I/O operation to get the error.
+    if ((revents & (minimk_syscall_pollerr | minimk_syscall_pollhup)) != 0) {
         return 0;
     }
 
@@ -183,6 +191,18 @@ static inline minimk_error_t minimk_runtime_coroutine_resume_io_impl(struct coro
     return MINIMK_ETIMEDOUT;
 }
 
+static inline void minimk_runtime_coroutine_suspend_sync_impl(struct coroutine *coro) noexcept {
+    MINIMK_TRACE_COROUTINE("%p RUNNABLE -> BLOCKED_ON_SYNC\n", CAST_VOID_P(coro));
+    coro->state = CORO_BLOCKED_ON_SYNC;
+}
+
+static inline void minimk_runtime_coroutine_wakeup_sync_impl(struct coroutine *coro) noexcept {
+    MINIMK_ASSERT(coro->state == CORO_BLOCKED_ON_SYNC);
+    MINIMK_ASSERT(coro->prev == nullptr && coro->next == nullptr);
+    MINIMK_TRACE_COROUTINE("%p BLOCKED_ON_SYNC -> RUNNABLE\n", CAST_VOID_P(coro));
+    coro->state = CORO_RUNNABLE;
+}
+
 static inline void minimk_runtime_coroutine_mark_as_exited_impl(struct coroutine *coro) noexcept {
     MINIMK_TRACE_COROUTINE("%p RUNNABLE -> EXITED\n", CAST_VOID_P(coro));
     coro->state = CORO_EXITED;
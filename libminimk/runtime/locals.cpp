@@ -0,0 +1,25 @@
+// File: libminimk/runtime/locals.cpp
+// Purpose: coroutine-local storage
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "locals.hpp" // for minimk_runtime_locals_get_impl
+#include "locals.h"   // for struct locals_registry
+
+/// Global registry of the coroutine-local storage keys.
+static locals_registry r0;
+
+minimk_error_t minimk_runtime_locals_key_create(size_t *key, void (*destructor)(void *value)) noexcept {
+    return minimk_runtime_locals_key_create_impl(&r0, key, destructor);
+}
+
+minimk_error_t minimk_runtime_locals_set(struct coroutine *coro, size_t key, void *value) noexcept {
+    return minimk_runtime_locals_set_impl(&r0, coro, key, value);
+}
+
+void *minimk_runtime_locals_get(struct coroutine *coro, size_t key) noexcept {
+    return minimk_runtime_locals_get_impl(&r0, coro, key);
+}
+
+void minimk_runtime_locals_destroy(struct coroutine *coro) noexcept {
+    minimk_runtime_locals_destroy_impl(&r0, coro);
+}
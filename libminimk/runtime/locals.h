@@ -0,0 +1,46 @@
+// File: libminimk/runtime/locals.h
+// Purpose: coroutine-local storage
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_LOCALS_H
+#define LIBMINIMK_RUNTIME_LOCALS_H
+
+#include "coroutine.h" // for MAX_LOCALS
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+/// Registry of the coroutine-local storage keys.
+///
+/// Keys are allocated in order and never released, such that a key
+/// is the index of the corresponding value inside the coroutine.
+struct locals_registry {
+    /// Destructor of each allocated key or NULL.
+    void (*destructors[MAX_LOCALS])(void *value);
+
+    /// Number of allocated keys.
+    size_t count;
+};
+
+MINIMK_BEGIN_DECLS
+
+/// Allocates a new key with the given, possibly NULL, destructor.
+///
+/// Returns MINIMK_EAGAIN if all the MAX_LOCALS keys are in use.
+minimk_error_t minimk_runtime_locals_key_create(size_t *key, void (*destructor)(void *value)) MINIMK_NOEXCEPT;
+
+/// Sets the value of the given key for the given coroutine.
+///
+/// Returns MINIMK_EINVAL if the key has not been allocated.
+minimk_error_t minimk_runtime_locals_set(struct coroutine *coro, size_t key, void *value) MINIMK_NOEXCEPT;
+
+/// Returns the value of the given key for the given coroutine or NULL.
+void *minimk_runtime_locals_get(struct coroutine *coro, size_t key) MINIMK_NOEXCEPT;
+
+/// Invokes the destructor of each key having a non-NULL value and clears the values.
+void minimk_runtime_locals_destroy(struct coroutine *coro) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_RUNTIME_LOCALS_H
@@ -0,0 +1,73 @@
+// File: libminimk/runtime/locals.hpp
+// Purpose: coroutine-local storage
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_LOCALS_HPP
+#define LIBMINIMK_RUNTIME_LOCALS_HPP
+
+#include "../cast/static.hpp" // for CAST_VOID_P
+
+#include "coroutine.h" // for struct coroutine
+#include "locals.h"    // for struct locals_registry
+
+#include <minimk/cdefs.h> // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/errno.h> // for minimk_error_t
+#include <minimk/trace.h> // for MINIMK_TRACE_COROUTINE
+
+#include <stddef.h> // for size_t
+
+static inline minimk_error_t minimk_runtime_locals_key_create_impl( //
+        struct locals_registry *reg, size_t *key, void (*destructor)(void *value)) noexcept {
+    if (reg->count >= MAX_LOCALS) {
+        return MINIMK_EAGAIN;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    reg->destructors[reg->count] = destructor;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    *key = reg->count++;
+    return 0;
+}
+
+static inline minimk_error_t minimk_runtime_locals_set_impl( //
+        struct locals_registry *reg, struct coroutine *coro, size_t key, void *value) noexcept {
+    if (key >= reg->count) {
+        return MINIMK_EINVAL;
+    }
+    MINIMK_TRACE_COROUTINE("%p locals_set\n", CAST_VOID_P(coro));
+    MINIMK_TRACE_COROUTINE("%p    key=%zu\n", CAST_VOID_P(coro), key);
+    MINIMK_TRACE_COROUTINE("%p    value=%p\n", CAST_VOID_P(coro), value);
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    coro->locals[key] = value;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return 0;
+}
+
+static inline void *minimk_runtime_locals_get_impl(struct locals_registry *reg, struct coroutine *coro,
+                                                   size_t key) noexcept {
+    if (key >= reg->count) {
+        return nullptr;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return coro->locals[key];
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+static inline void minimk_runtime_locals_destroy_impl(struct locals_registry *reg,
+                                                      struct coroutine *coro) noexcept {
+    for (size_t key = 0; key < reg->count; key++) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        void *value = coro->locals[key];
+        coro->locals[key] = nullptr;
+        void (*destructor)(void *value) = reg->destructors[key];
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+
+        // Like pthread keys, we only invoke the destructor for non-NULL values
+        if (value != nullptr && destructor != nullptr) {
+            MINIMK_TRACE_COROUTINE("%p locals_destroy\n", CAST_VOID_P(coro));
+            MINIMK_TRACE_COROUTINE("%p    key=%zu\n", CAST_VOID_P(coro), key);
+            MINIMK_TRACE_COROUTINE("%p    value=%p\n", CAST_VOID_P(coro), value);
+            destructor(value);
+        }
+    }
+}
+
+#endif // LIBMINIMK_RUNTIME_LOCALS_HPP
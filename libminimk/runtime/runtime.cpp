@@ -5,8 +5,10 @@
 #include "../integer/u64.h" // for minimk_integer_u64_satadd
 
 #include "coroutine.h" // for struct coroutine
+#include "locals.h"    // for minimk_runtime_locals_get
 #include "scheduler.h" // for struct scheduler
 #include "switch.h"    // for minimk_switch
+#include "sync.h"      // for minimk_runtime_sync_mutex_lock
 
 #include <minimk/assert.h>  // for MINIMK_ASSERT
 #include <minimk/cdefs.h>   // for MINIMK_BEGIN_DECLS
@@ -44,3 +46,54 @@ minimk_error_t minimk_runtime_suspend_read(minimk_syscall_socket_t sock, uint64_
 minimk_error_t minimk_runtime_suspend_write(minimk_syscall_socket_t sock, uint64_t nanosec) MINIMK_NOEXCEPT {
     return minimk_runtime_scheduler_coroutine_suspend_io(&s0, sock, minimk_syscall_pollout, nanosec);
 }
+
+minimk_error_t minimk_runtime_suspend_error(minimk_syscall_socket_t sock, uint64_t nanosec) MINIMK_NOEXCEPT {
+    return minimk_runtime_scheduler_coroutine_suspend_io(&s0, sock, minimk_syscall_pollerr, nanosec);
+}
+
+minimk_error_t minimk_runtime_local_key_create(size_t *key, void (*destructor)(void *value)) noexcept {
+    return minimk_runtime_locals_key_create(key, destructor);
+}
+
+minimk_error_t minimk_runtime_local_set(size_t key, void *value) noexcept {
+    MINIMK_ASSERT(s0.current != nullptr);
+    return minimk_runtime_locals_set(s0.current, key, value);
+}
+
+void *minimk_runtime_local_get(size_t key) noexcept {
+    MINIMK_ASSERT(s0.current != nullptr);
+    return minimk_runtime_locals_get(s0.current, key);
+}
+
+void minimk_runtime_mutex_lock(struct minimk_runtime_mutex *mutex) noexcept {
+    minimk_runtime_sync_mutex_lock(&s0, mutex);
+}
+
+void minimk_runtime_mutex_unlock(struct minimk_runtime_mutex *mutex) noexcept {
+    minimk_runtime_sync_mutex_unlock(&s0, mutex);
+}
+
+void minimk_runtime_semaphore_init(struct minimk_runtime_semaphore *sema, uint64_t count) noexcept {
+    *sema = {};
+    sema->count = count;
+}
+
+void minimk_runtime_semaphore_wait(struct minimk_runtime_semaphore *sema) noexcept {
+    minimk_runtime_sync_semaphore_wait(&s0, sema);
+}
+
+void minimk_runtime_semaphore_post(struct minimk_runtime_semaphore *sema) noexcept {
+    minimk_runtime_sync_semaphore_post(sema);
+}
+
+void minimk_runtime_cond_wait(struct minimk_runtime_cond *cond, struct minimk_runtime_mutex *mutex) noexcept {
+    minimk_runtime_sync_cond_wait(&s0, cond, mutex);
+}
+
+void minimk_runtime_cond_signal(struct minimk_runtime_cond *cond) noexcept {
+    minimk_runtime_sync_cond_signal(cond);
+}
+
+void minimk_runtime_cond_broadcast(struct minimk_runtime_cond *cond) noexcept {
+    minimk_runtime_sync_cond_broadcast(cond);
+}
@@ -20,6 +20,23 @@ minimk_error_t minimk_runtime_scheduler_find_free_coroutine_slot( //
     return minimk_runtime_scheduler_find_free_coroutine_slot_impl(sched, found);
 }
 
+struct ioqueue *minimk_runtime_scheduler_get_ioqueue_slot(struct scheduler *sched, size_t idx) noexcept {
+    return minimk_runtime_scheduler_get_ioqueue_slot_impl(sched, idx);
+}
+
+minimk_error_t minimk_runtime_scheduler_find_ioqueue( //
+        struct scheduler *sched, minimk_syscall_socket_t sock, struct ioqueue **found) noexcept {
+    return minimk_runtime_scheduler_find_ioqueue_impl(sched, sock, found);
+}
+
+void minimk_runtime_scheduler_ioqueue_park(struct scheduler *sched, struct coroutine *coro) noexcept {
+    minimk_runtime_scheduler_ioqueue_park_impl(sched, coro);
+}
+
+void minimk_runtime_scheduler_ioqueue_unpark(struct scheduler *sched, struct coroutine *coro) noexcept {
+    minimk_runtime_scheduler_ioqueue_unpark_impl(sched, coro);
+}
+
 void minimk_runtime_scheduler_clean_exited_coroutines(struct scheduler *sched) noexcept {
     minimk_runtime_scheduler_clean_exited_coroutines_impl(sched);
 }
@@ -70,3 +87,8 @@ minimk_error_t minimk_runtime_scheduler_coroutine_suspend_io( //
         struct scheduler *sched, minimk_syscall_socket_t sock, short events, uint64_t nanosec) noexcept {
     return minimk_runtime_scheduler_coroutine_suspend_io_impl(sched, sock, events, nanosec);
 }
+
+void minimk_runtime_scheduler_coroutine_suspend_sync(struct scheduler *sched,
+                                                     struct minimk_runtime_waitlist *list) noexcept {
+    minimk_runtime_scheduler_coroutine_suspend_sync_impl(sched, list);
+}
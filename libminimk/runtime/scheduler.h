@@ -5,6 +5,7 @@
 #define LIBMINIMK_RUNTIME_SCHEDULER_H
 
 #include "coroutine.h" // for struct coroutine
+#include "waitlist.h"  // for struct minimk_runtime_waitlist
 
 #include <minimk/cdefs.h>   // for MINIMK_BEGIN_DECLS
 #include <minimk/errno.h>   // for minimk_error_t
@@ -16,11 +17,43 @@
 /// Maximum number of coroutines we can create.
 #define MAX_COROS 16
 
+/// Queue of coroutines blocked on I/O on the same socket.
+///
+/// All the coroutines waiting on a socket share a single queue, which becomes
+/// a single pollfd entry whose events are the union of the readers and writers
+/// interests. This allows, e.g., a reader and a writer coroutine to wait on the
+/// same socket concurrently when implementing full-duplex protocols.
+///
+/// Coroutines in the errors list only wait for POLLERR, which poll always
+/// reports, so they do not contribute any event to the pollfd entry.
+///
+/// The queue is free when the readers, writers, and errors lists are empty.
+struct ioqueue {
+    /// Coroutines waiting for the socket to become readable.
+    struct minimk_runtime_waitlist readers;
+
+    /// Coroutines waiting for the socket to become writable.
+    struct minimk_runtime_waitlist writers;
+
+    /// Coroutines waiting for pending socket errors (e.g., zero-copy completions).
+    struct minimk_runtime_waitlist errors;
+
+    /// The socket the coroutines are waiting for.
+    minimk_syscall_socket_t sock;
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+};
+
 /// Coroutine scheduler.
 struct scheduler {
     /// Slots for coroutines we manage.
     struct coroutine coroutines[MAX_COROS];
 
+    /// Slots for I/O queues. Since each blocked coroutine waits for
+    /// a single socket, we need at most one queue per coroutine.
+    struct ioqueue ioqueues[MAX_COROS];
+
     /// Pointer to currently running coroutine.
     struct coroutine *current;
 
@@ -38,6 +71,20 @@ struct coroutine *minimk_runtime_scheduler_get_coroutine_slot(struct scheduler *
 minimk_error_t minimk_runtime_scheduler_find_free_coroutine_slot( //
         struct scheduler *sched, struct coroutine **found) MINIMK_NOEXCEPT;
 
+/// Returns the ioqueue slot corresponding to the given index or panics.
+struct ioqueue *minimk_runtime_scheduler_get_ioqueue_slot(struct scheduler *sched,
+                                                          size_t idx) MINIMK_NOEXCEPT;
+
+/// Find the ioqueue used by the given socket or a free one or return a nonzero error.
+minimk_error_t minimk_runtime_scheduler_find_ioqueue( //
+        struct scheduler *sched, minimk_syscall_socket_t sock, struct ioqueue **found) MINIMK_NOEXCEPT;
+
+/// Adds a coroutine blocked on I/O to the ioqueue of the socket it is waiting for.
+void minimk_runtime_scheduler_ioqueue_park(struct scheduler *sched, struct coroutine *coro) MINIMK_NOEXCEPT;
+
+/// Removes a coroutine blocked on I/O from the ioqueue of the socket it is waiting for.
+void minimk_runtime_scheduler_ioqueue_unpark(struct scheduler *sched, struct coroutine *coro) MINIMK_NOEXCEPT;
+
 /// Frees resources used by all the exited coroutines.
 void minimk_runtime_scheduler_clean_exited_coroutines(struct scheduler *sched) MINIMK_NOEXCEPT;
 
@@ -82,6 +129,10 @@ minimk_error_t minimk_runtime_scheduler_coroutine_suspend_io( //
         struct scheduler *sched, minimk_syscall_socket_t sock, short events,
         uint64_t nanosec) MINIMK_NOEXCEPT;
 
+/// Suspends current coroutine in the given waitlist until another coroutine wakes it up.
+void minimk_runtime_scheduler_coroutine_suspend_sync(struct scheduler *sched,
+                                                     struct minimk_runtime_waitlist *list) MINIMK_NOEXCEPT;
+
 MINIMK_END_DECLS
 
 #endif // LIBMINIMK_RUNTIME_SCHEDULER_H
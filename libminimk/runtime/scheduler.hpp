@@ -10,6 +10,7 @@
 #include "coroutine.h" // for struct coroutine
 #include "scheduler.h" // for struct scheduler
 #include "switch.h"    // for minimk_switch
+#include "waitlist.h"  // for minimk_runtime_waitlist_*
 
 #include <minimk/assert.h>  // for MINIMK_ASSERT
 #include <minimk/cdefs.h>   // for MINIMK_UNSAFE_BUFFER_USAGE_*
@@ -46,6 +47,91 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_scheduler_find_free_coroutine
     return MINIMK_EAGAIN;
 }
 
+static inline struct ioqueue *minimk_runtime_scheduler_get_ioqueue_slot_impl( //
+        struct scheduler *sched, size_t idx) noexcept {
+    MINIMK_ASSERT(idx < MAX_COROS);
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return &sched->ioqueues[idx];
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+/// Returns whether the given ioqueue is not used by any coroutine.
+static inline bool minimk_runtime_scheduler_ioqueue_is_free(struct ioqueue *queue) noexcept {
+    return queue->readers.head == nullptr && queue->writers.head == nullptr &&
+           queue->errors.head == nullptr;
+}
+
+/// Returns the list of the given ioqueue where a coroutine waiting for the given events belongs.
+static inline struct minimk_runtime_waitlist *minimk_runtime_scheduler_ioqueue_list( //
+        struct ioqueue *queue, short events) noexcept {
+    if (events == minimk_syscall_pollin) {
+        return &queue->readers;
+    }
+    if (events == minimk_syscall_pollout) {
+        return &queue->writers;
+    }
+    return &queue->errors;
+}
+
+template <decltype(minimk_runtime_scheduler_get_ioqueue_slot) M_get =
+                  minimk_runtime_scheduler_get_ioqueue_slot>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_scheduler_find_ioqueue_impl( //
+        struct scheduler *sched, minimk_syscall_socket_t sock, struct ioqueue **found) noexcept {
+    struct ioqueue *avail = nullptr;
+    for (size_t idx = 0; idx < MAX_COROS; idx++) {
+        struct ioqueue *queue = M_get(sched, idx);
+        if (minimk_runtime_scheduler_ioqueue_is_free(queue)) {
+            avail = (avail == nullptr) ? queue : avail;
+            continue;
+        }
+        if (queue->sock == sock) {
+            *found = queue;
+            return 0;
+        }
+    }
+    if (avail == nullptr) {
+        return MINIMK_EAGAIN;
+    }
+    MINIMK_TRACE_SCHEDULER("%p found ioqueue=%p\n", CAST_VOID_P(sched), CAST_VOID_P(avail));
+    avail->sock = sock;
+    *found = avail;
+    return 0;
+}
+
+template <decltype(minimk_runtime_scheduler_find_ioqueue) M_find = minimk_runtime_scheduler_find_ioqueue,
+          decltype(minimk_runtime_waitlist_push) M_push = minimk_runtime_waitlist_push>
+MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_ioqueue_park_impl(struct scheduler *sched,
+                                                                     struct coroutine *coro) noexcept {
+    // Ensure the coroutine is waiting for either reading, writing, or errors
+    MINIMK_ASSERT(coro->state == CORO_BLOCKED_ON_IO);
+    MINIMK_ASSERT(coro->events == minimk_syscall_pollin || coro->events == minimk_syscall_pollout ||
+                  coro->events == minimk_syscall_pollerr);
+
+    // There is always a queue available since we have one per coroutine
+    struct ioqueue *queue = nullptr;
+    minimk_error_t rv = M_find(sched, coro->sock, &queue);
+    MINIMK_ASSERT(rv == 0);
+
+    MINIMK_TRACE_SCHEDULER("%p park %p\n", CAST_VOID_P(sched), CAST_VOID_P(coro));
+    MINIMK_TRACE_SCHEDULER("%p    ioqueue=%p\n", CAST_VOID_P(sched), CAST_VOID_P(queue));
+    M_push(minimk_runtime_scheduler_ioqueue_list(queue, coro->events), coro);
+}
+
+template <decltype(minimk_runtime_scheduler_find_ioqueue) M_find = minimk_runtime_scheduler_find_ioqueue,
+          decltype(minimk_runtime_waitlist_remove) M_remove = minimk_runtime_waitlist_remove>
+MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_ioqueue_unpark_impl(struct scheduler *sched,
+                                                                       struct coroutine *coro) noexcept {
+    // The coroutine is parked so its queue must exist
+    MINIMK_ASSERT(coro->state == CORO_BLOCKED_ON_IO);
+    struct ioqueue *queue = nullptr;
+    minimk_error_t rv = M_find(sched, coro->sock, &queue);
+    MINIMK_ASSERT(rv == 0 && !minimk_runtime_scheduler_ioqueue_is_free(queue));
+
+    MINIMK_TRACE_SCHEDULER("%p unpark %p\n", CAST_VOID_P(sched), CAST_VOID_P(coro));
+    MINIMK_TRACE_SCHEDULER("%p    ioqueue=%p\n", CAST_VOID_P(sched), CAST_VOID_P(queue));
+    M_remove(minimk_runtime_scheduler_ioqueue_list(queue, coro->events), coro);
+}
+
 template <decltype(minimk_runtime_scheduler_get_coroutine_slot) M_get =
                   minimk_runtime_scheduler_get_coroutine_slot,
           decltype(minimk_runtime_coroutine_finish) M_finish = minimk_runtime_coroutine_finish>
@@ -62,12 +148,21 @@ minimk_runtime_scheduler_clean_exited_coroutines_impl(struct scheduler *sched) n
 
 template <decltype(minimk_runtime_scheduler_get_coroutine_slot) M_get =
                   minimk_runtime_scheduler_get_coroutine_slot,
+          decltype(minimk_runtime_scheduler_ioqueue_unpark) M_unpark =
+                  minimk_runtime_scheduler_ioqueue_unpark,
           decltype(minimk_runtime_coroutine_maybe_resume) M_resume = minimk_runtime_coroutine_maybe_resume>
 MINIMK_ALWAYS_INLINE void
 minimk_runtime_scheduler_maybe_expire_deadlines_impl(struct scheduler *sched) noexcept {
     uint64_t now = minimk_time_monotonic_now();
     for (size_t idx = 0; idx < MAX_COROS; idx++) {
-        M_resume(M_get(sched, idx), now, 0);
+        coroutine *coro = M_get(sched, idx);
+
+        // Coroutines timing out on I/O must leave their ioqueue first
+        if (coro->state == CORO_BLOCKED_ON_IO && now >= coro->deadline) {
+            M_unpark(sched, coro);
+        }
+
+        M_resume(coro, now, 0);
     }
 }
 
@@ -103,7 +198,10 @@ minimk_runtime_scheduler_count_nonnull_coroutines_impl(struct scheduler *sched)
 
 template <decltype(minimk_runtime_scheduler_get_coroutine_slot) M_get =
                   minimk_runtime_scheduler_get_coroutine_slot,
+          decltype(minimk_runtime_scheduler_get_ioqueue_slot) M_get_ioqueue =
+                  minimk_runtime_scheduler_get_ioqueue_slot,
           decltype(minimk_syscall_poll) M_poll = minimk_syscall_poll,
+          decltype(minimk_runtime_waitlist_pop) M_pop = minimk_runtime_waitlist_pop,
           decltype(minimk_runtime_coroutine_maybe_resume) M_resume = minimk_runtime_coroutine_maybe_resume>
 MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_block_on_poll_impl(struct scheduler *sched) noexcept {
     // 1. pick a reasonable default deadline to avoid blocking for too much time.
@@ -114,54 +212,53 @@ MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_block_on_poll_impl(struct sch
     MINIMK_TRACE_SCHEDULER("%p poll\n", CAST_VOID_P(sched));
     MINIMK_TRACE_SCHEDULER("%p    initial deadline=%llu [us]\n", CAST_VOID_P(sched), CAST_ULL(deadline));
 
-    // 2. we need to poll at most a socket per coroutine.
-    //
-    // On linux/amd64 each structure is 8 byte and we have 16 coroutines
-    // which causes the stack to grow by 128 bytes.
-    minimk_syscall_pollfd_t fds[MAX_COROS] = {};
-    size_t numfds = MAX_COROS;
-
-    // 3. scan the coroutines list and init deadline and fds.
+    // 2. scan the coroutines list and adjust the deadline.
     for (size_t idx = 0; idx < MAX_COROS; idx++) {
         auto coro = M_get(sched, idx);
-
-        // 3.1. arm timers
-        if (coro->state == CORO_BLOCKED_ON_TIMER) {
+        if (coro->state == CORO_BLOCKED_ON_TIMER || coro->state == CORO_BLOCKED_ON_IO) {
             deadline = (coro->deadline < deadline) ? coro->deadline : deadline;
-            continue;
         }
+    }
 
-        // 3.2. deal with I/O
-        if (coro->state == CORO_BLOCKED_ON_IO) {
-            deadline = (coro->deadline < deadline) ? coro->deadline : deadline;
+    MINIMK_TRACE_SCHEDULER("%p    adjusted deadline=%llu [us]\n", CAST_VOID_P(sched), CAST_ULL(deadline));
 
-            MINIMK_ASSERT(coro->sock != minimk_syscall_invalid_socket);
-            MINIMK_ASSERT(coro->events != 0);
-            MINIMK_ASSERT(coro->revents == 0);
+    // 3. we need to poll at most a socket per ioqueue.
+    //
+    // On linux/amd64 each structure is 8 byte and we have 16 ioqueues
+    // which causes the stack to grow by 128 bytes.
+    minimk_syscall_pollfd_t fds[MAX_COROS] = {};
+    size_t numfds = MAX_COROS;
 
-            MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
-            auto fd = &fds[idx];
-            MINIMK_UNSAFE_BUFFER_USAGE_END
+    // 4. scan the ioqueues and merge the waiters interests into a single entry.
+    for (size_t idx = 0; idx < MAX_COROS; idx++) {
+        auto queue = M_get_ioqueue(sched, idx);
 
-            fd->events = coro->events;
-            fd->fd = coro->sock;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        auto fd = &fds[idx];
+        MINIMK_UNSAFE_BUFFER_USAGE_END
 
-            MINIMK_TRACE_SCHEDULER("%p      fd=%llu\n", CAST_VOID_P(sched), CAST_ULL(coro->sock));
-            MINIMK_TRACE_SCHEDULER("%p        events=%llu\n", CAST_VOID_P(sched), CAST_ULL(coro->events));
+        // Negative descriptors are ignored by poll
+        fd->fd = minimk_syscall_invalid_socket;
+        if (minimk_runtime_scheduler_ioqueue_is_free(queue)) {
             continue;
         }
-    }
 
-    MINIMK_TRACE_SCHEDULER("%p    adjusted deadline=%llu [us]\n", CAST_VOID_P(sched), CAST_ULL(deadline));
+        fd->fd = queue->sock;
+        fd->events |= (queue->readers.head != nullptr) ? minimk_syscall_pollin : 0;
+        fd->events |= (queue->writers.head != nullptr) ? minimk_syscall_pollout : 0;
 
-    // 4. compute the poll timeout.
+        MINIMK_TRACE_SCHEDULER("%p      fd=%llu\n", CAST_VOID_P(sched), CAST_ULL(fd->fd));
+        MINIMK_TRACE_SCHEDULER("%p        events=%llu\n", CAST_VOID_P(sched), CAST_ULL(fd->events));
+    }
+
+    // 5. compute the poll timeout.
     uint64_t poll_timeout64 = (((deadline > now) ? (deadline - now) : 0) / 1000000) + 1;
     int poll_timeout = static_cast<int>((poll_timeout64) < INT_MAX ? poll_timeout64 : INT_MAX);
 
     MINIMK_TRACE_SCHEDULER("%p    timeout64=%llu [ms]\n", CAST_VOID_P(sched), CAST_ULL(poll_timeout64));
     MINIMK_TRACE_SCHEDULER("%p    timeout=%llu [ms]\n", CAST_VOID_P(sched), CAST_ULL(poll_timeout));
 
-    // 5. invoke the poll system call and handle is result.
+    // 6. invoke the poll system call and handle is result.
     //
     // Note that under Linux poll fails in these cases:
     //
@@ -185,15 +282,40 @@ MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_block_on_poll_impl(struct sch
     }
     MINIMK_ASSERT(poll_rc == 0);
 
-    // 6. check what we need to resume now
+    // 7. dispatch the events to the waiters of each ioqueue. We wake up all the
+    // waiters interested to an event, plus all of them on error or hangup, such
+    // that they retry the I/O operation and possibly observe the error. Note
+    // that the scheduler loop takes care of expiring deadlines.
+    //
+    // When there are error waiters, POLLERR most likely signals zero-copy
+    // completions, so we only wake them up, since they drain the error queue
+    // and otherwise readers and writers would keep waking up for nothing.
     now = minimk_time_monotonic_now();
     for (size_t idx = 0; idx < MAX_COROS; idx++) {
+        auto queue = M_get_ioqueue(sched, idx);
 
         MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
-        auto fd = &fds[idx];
+        short revents = fds[idx].revents;
         MINIMK_UNSAFE_BUFFER_USAGE_END
 
-        M_resume(M_get(sched, idx), now, fd->revents);
+        short failure = minimk_syscall_pollhup;
+        failure |= (queue->errors.head == nullptr) ? minimk_syscall_pollerr : 0;
+
+        if ((revents & (minimk_syscall_pollin | failure)) != 0) {
+            for (coroutine *coro = nullptr; (coro = M_pop(&queue->readers)) != nullptr;) {
+                M_resume(coro, now, revents);
+            }
+        }
+        if ((revents & (minimk_syscall_pollout | failure)) != 0) {
+            for (coroutine *coro = nullptr; (coro = M_pop(&queue->writers)) != nullptr;) {
+                M_resume(coro, now, revents);
+            }
+        }
+        if ((revents & (minimk_syscall_pollerr | minimk_syscall_pollhup)) != 0) {
+            for (coroutine *coro = nullptr; (coro = M_pop(&queue->errors)) != nullptr;) {
+                M_resume(coro, now, revents);
+            }
+        }
     }
 }
 
@@ -345,6 +467,7 @@ MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_coroutine_suspend_timer_impl(
 
 template <
         decltype(minimk_runtime_coroutine_suspend_io) M_suspend = minimk_runtime_coroutine_suspend_io,
+        decltype(minimk_runtime_scheduler_ioqueue_park) M_park = minimk_runtime_scheduler_ioqueue_park,
         decltype(minimk_runtime_scheduler_coroutine_yield) M_yield = minimk_runtime_scheduler_coroutine_yield,
         decltype(minimk_runtime_coroutine_resume_io) M_resume = minimk_runtime_coroutine_resume_io>
 MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_scheduler_coroutine_suspend_io_impl( //
@@ -352,8 +475,9 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_scheduler_coroutine_suspend_i
     // Ensure we're inside the coroutine world.
     MINIMK_ASSERT(sched->current != nullptr);
 
-    // Actually suspend the coroutine
+    // Actually suspend the coroutine and wait in the socket ioqueue
     M_suspend(sched->current, sock, events, nanosec);
+    M_park(sched, sched->current);
 
     // Schedule
     M_yield(sched);
@@ -362,4 +486,24 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_scheduler_coroutine_suspend_i
     return M_resume(sched->current, sock, events);
 }
 
+template <
+        decltype(minimk_runtime_coroutine_suspend_sync) M_suspend = minimk_runtime_coroutine_suspend_sync,
+        decltype(minimk_runtime_waitlist_push) M_push = minimk_runtime_waitlist_push,
+        decltype(minimk_runtime_scheduler_coroutine_yield) M_yield = minimk_runtime_scheduler_coroutine_yield>
+MINIMK_ALWAYS_INLINE void minimk_runtime_scheduler_coroutine_suspend_sync_impl(
+        struct scheduler *sched, struct minimk_runtime_waitlist *list) noexcept {
+    // Ensure we're inside the coroutine world.
+    MINIMK_ASSERT(sched->current != nullptr);
+
+    // Suspend and wait in the list
+    M_suspend(sched->current);
+    M_push(list, sched->current);
+
+    // Schedule
+    M_yield(sched);
+
+    // Whoever woke us up must have made us runnable
+    MINIMK_ASSERT(sched->current->state == CORO_RUNNABLE);
+}
+
 #endif // LIBMINIMK_RUNTIME_SCHEDULER_HPP
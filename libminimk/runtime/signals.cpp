@@ -0,0 +1,16 @@
+// File: libminimk/runtime/signals.cpp
+// Purpose: waiting for signals inside coroutines
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "signals.hpp" // for minimk_runtime_signal_wait_impl
+#include "signals.h"   // for struct signals
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_signal_wait
+
+/// Global descriptors for receiving signals.
+static signals g0;
+
+minimk_error_t minimk_runtime_signal_wait(int signo) noexcept {
+    return minimk_runtime_signal_wait_impl(&g0, signo);
+}
@@ -0,0 +1,26 @@
+// File: libminimk/runtime/signals.h
+// Purpose: waiting for signals inside coroutines
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_SIGNALS_H
+#define LIBMINIMK_RUNTIME_SIGNALS_H
+
+#include <minimk/syscall.h> // for minimk_syscall_socket_t
+
+#include <stdint.h> // for uint64_t
+
+/// Maximum signal number we can wait for.
+#define MAX_SIGNALS 64
+
+/// Descriptors for receiving signals, lazily created.
+struct signals {
+    /// Descriptor for each signal, valid only when created.
+    minimk_syscall_socket_t fds[MAX_SIGNALS + 1];
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+
+    /// Bitmask of the signals whose descriptor has been created.
+    uint64_t created;
+};
+
+#endif // LIBMINIMK_RUNTIME_SIGNALS_H
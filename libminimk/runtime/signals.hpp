@@ -0,0 +1,58 @@
+// File: libminimk/runtime/signals.hpp
+// Purpose: waiting for signals inside coroutines
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_SIGNALS_HPP
+#define LIBMINIMK_RUNTIME_SIGNALS_HPP
+
+#include "signals.h" // for struct signals
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_read
+#include <minimk/syscall.h> // for minimk_syscall_signalfd
+
+#include <signal.h> // for SIGKILL, SIGSTOP
+#include <stdint.h> // for UINT64_MAX
+
+/// Testable minimk_runtime_signal_wait implementation.
+template <decltype(minimk_syscall_signalfd) M_signalfd = minimk_syscall_signalfd,
+          decltype(minimk_syscall_signalfd_read) M_read = minimk_syscall_signalfd_read,
+          decltype(minimk_runtime_suspend_read) M_suspend = minimk_runtime_suspend_read>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_runtime_signal_wait_impl(struct signals *sigs,
+                                                                    int signo) noexcept {
+    // Make sure the signal number is valid and the signal can be blocked, since
+    // SIGKILL and SIGSTOP never become pending and we would wait forever
+    if (signo <= 0 || signo > MAX_SIGNALS || signo == SIGKILL || signo == SIGSTOP) {
+        return MINIMK_EINVAL;
+    }
+
+    // Lazily create the descriptor the first time someone waits for the signal
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    minimk_syscall_socket_t *fd = &sigs->fds[signo];
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    uint64_t bit = static_cast<uint64_t>(1) << (signo - 1);
+    if ((sigs->created & bit) == 0) {
+        minimk_error_t rv = M_signalfd(fd, signo);
+        if (rv != 0) {
+            return rv;
+        }
+        sigs->created |= bit;
+    }
+
+    // Consume a pending signal or suspend until the signal is pending. Since several
+    // coroutines may wait for the same signal, we may be woken up without a pending
+    // signal, in which case we need to suspend again.
+    for (;;) {
+        int got = 0;
+        minimk_error_t rv = M_read(*fd, &got);
+        if (rv != MINIMK_EAGAIN) {
+            return rv;
+        }
+        rv = M_suspend(*fd, UINT64_MAX);
+        if (rv != 0) {
+            return rv;
+        }
+    }
+}
+
+#endif // LIBMINIMK_RUNTIME_SIGNALS_HPP
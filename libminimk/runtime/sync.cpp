@@ -0,0 +1,36 @@
+// File: libminimk/runtime/sync.cpp
+// Purpose: coroutine synchronization primitives
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sync.hpp" // for minimk_runtime_sync_mutex_lock_impl
+#include "sync.h"   // for minimk_runtime_sync_*
+
+void minimk_runtime_sync_mutex_lock(struct scheduler *sched, struct minimk_runtime_mutex *mutex) noexcept {
+    minimk_runtime_sync_mutex_lock_impl(sched, mutex);
+}
+
+void minimk_runtime_sync_mutex_unlock(struct scheduler *sched, struct minimk_runtime_mutex *mutex) noexcept {
+    minimk_runtime_sync_mutex_unlock_impl(sched, mutex);
+}
+
+void minimk_runtime_sync_semaphore_wait(struct scheduler *sched,
+                                        struct minimk_runtime_semaphore *sema) noexcept {
+    minimk_runtime_sync_semaphore_wait_impl(sched, sema);
+}
+
+void minimk_runtime_sync_semaphore_post(struct minimk_runtime_semaphore *sema) noexcept {
+    minimk_runtime_sync_semaphore_post_impl(sema);
+}
+
+void minimk_runtime_sync_cond_wait(struct scheduler *sched, struct minimk_runtime_cond *cond,
+                                   struct minimk_runtime_mutex *mutex) noexcept {
+    minimk_runtime_sync_cond_wait_impl(sched, cond, mutex);
+}
+
+void minimk_runtime_sync_cond_signal(struct minimk_runtime_cond *cond) noexcept {
+    minimk_runtime_sync_cond_signal_impl(cond);
+}
+
+void minimk_runtime_sync_cond_broadcast(struct minimk_runtime_cond *cond) noexcept {
+    minimk_runtime_sync_cond_broadcast_impl(cond);
+}
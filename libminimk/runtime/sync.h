@@ -0,0 +1,43 @@
+// File: libminimk/runtime/sync.h
+// Purpose: coroutine synchronization primitives
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_SYNC_H
+#define LIBMINIMK_RUNTIME_SYNC_H
+
+#include "scheduler.h" // for struct scheduler
+
+#include <minimk/cdefs.h>   // for MINIMK_BEGIN_DECLS
+#include <minimk/runtime.h> // for struct minimk_runtime_mutex
+
+#include <stdint.h> // for uint64_t
+
+MINIMK_BEGIN_DECLS
+
+/// Acquires the mutex on behalf of the current coroutine.
+void minimk_runtime_sync_mutex_lock(struct scheduler *sched,
+                                    struct minimk_runtime_mutex *mutex) MINIMK_NOEXCEPT;
+
+/// Releases the mutex owned by the current coroutine.
+void minimk_runtime_sync_mutex_unlock(struct scheduler *sched,
+                                      struct minimk_runtime_mutex *mutex) MINIMK_NOEXCEPT;
+
+/// Acquires a semaphore permit on behalf of the current coroutine.
+void minimk_runtime_sync_semaphore_wait(struct scheduler *sched,
+                                        struct minimk_runtime_semaphore *sema) MINIMK_NOEXCEPT;
+
+/// Releases a semaphore permit.
+void minimk_runtime_sync_semaphore_post(struct minimk_runtime_semaphore *sema) MINIMK_NOEXCEPT;
+
+/// Waits for the condition on behalf of the current coroutine.
+void minimk_runtime_sync_cond_wait(struct scheduler *sched, struct minimk_runtime_cond *cond,
+                                   struct minimk_runtime_mutex *mutex) MINIMK_NOEXCEPT;
+
+/// Wakes up the first coroutine waiting for the condition.
+void minimk_runtime_sync_cond_signal(struct minimk_runtime_cond *cond) MINIMK_NOEXCEPT;
+
+/// Wakes up all the coroutines waiting for the condition.
+void minimk_runtime_sync_cond_broadcast(struct minimk_runtime_cond *cond) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_RUNTIME_SYNC_H
@@ -0,0 +1,122 @@
+// File: libminimk/runtime/sync.hpp
+// Purpose: coroutine synchronization primitives
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_SYNC_HPP
+#define LIBMINIMK_RUNTIME_SYNC_HPP
+
+#include "../cast/static.hpp" // for CAST_VOID_P
+
+#include "coroutine.h" // for minimk_runtime_coroutine_wakeup_sync
+#include "scheduler.h" // for minimk_runtime_scheduler_coroutine_suspend_sync
+#include "sync.h"      // for minimk_runtime_sync_*
+#include "waitlist.h"  // for minimk_runtime_waitlist_pop
+
+#include <minimk/assert.h>  // for MINIMK_ASSERT
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/runtime.h> // for struct minimk_runtime_mutex
+#include <minimk/trace.h>   // for MINIMK_TRACE_SCHEDULER
+
+#include <stdint.h> // for uint64_t
+
+template <decltype(minimk_runtime_scheduler_coroutine_suspend_sync) M_suspend =
+                  minimk_runtime_scheduler_coroutine_suspend_sync>
+MINIMK_ALWAYS_INLINE void minimk_runtime_sync_mutex_lock_impl(struct scheduler *sched,
+                                                              struct minimk_runtime_mutex *mutex) noexcept {
+    // Ensure we're inside the coroutine world and not already owning the mutex
+    MINIMK_ASSERT(sched->current != nullptr);
+    MINIMK_ASSERT(mutex->owner != sched->current);
+
+    // Fast path: the mutex is free so just take it
+    if (mutex->owner == nullptr) {
+        mutex->owner = sched->current;
+        return;
+    }
+
+    // Slow path: wait until unlock transfers the ownership to us
+    MINIMK_TRACE_SCHEDULER("%p mutex_lock %p contended\n", CAST_VOID_P(sched), CAST_VOID_P(mutex));
+    M_suspend(sched, &mutex->waiters);
+    MINIMK_ASSERT(mutex->owner == sched->current);
+}
+
+template <decltype(minimk_runtime_waitlist_pop) M_pop = minimk_runtime_waitlist_pop,
+          decltype(minimk_runtime_coroutine_wakeup_sync) M_wakeup = minimk_runtime_coroutine_wakeup_sync>
+MINIMK_ALWAYS_INLINE void minimk_runtime_sync_mutex_unlock_impl(struct scheduler *sched,
+                                                                struct minimk_runtime_mutex *mutex) noexcept {
+    // Ensure we're owning the mutex
+    MINIMK_ASSERT(sched->current != nullptr);
+    MINIMK_ASSERT(mutex->owner == sched->current);
+
+    // Transfer the ownership directly to the first waiter, if any, such that
+    // another coroutine cannot steal the mutex before the waiter runs.
+    mutex->owner = M_pop(&mutex->waiters);
+    if (mutex->owner != nullptr) {
+        M_wakeup(mutex->owner);
+    }
+}
+
+template <decltype(minimk_runtime_scheduler_coroutine_suspend_sync) M_suspend =
+                  minimk_runtime_scheduler_coroutine_suspend_sync>
+MINIMK_ALWAYS_INLINE void minimk_runtime_sync_semaphore_wait_impl( //
+        struct scheduler *sched, struct minimk_runtime_semaphore *sema) noexcept {
+    // Ensure we're inside the coroutine world
+    MINIMK_ASSERT(sched->current != nullptr);
+
+    // Fast path: there are available permits
+    if (sema->count > 0) {
+        sema->count--;
+        return;
+    }
+
+    // Slow path: wait until post transfers a permit to us
+    MINIMK_TRACE_SCHEDULER("%p semaphore_wait %p contended\n", CAST_VOID_P(sched), CAST_VOID_P(sema));
+    M_suspend(sched, &sema->waiters);
+}
+
+template <decltype(minimk_runtime_waitlist_pop) M_pop = minimk_runtime_waitlist_pop,
+          decltype(minimk_runtime_coroutine_wakeup_sync) M_wakeup = minimk_runtime_coroutine_wakeup_sync>
+MINIMK_ALWAYS_INLINE void
+minimk_runtime_sync_semaphore_post_impl(struct minimk_runtime_semaphore *sema) noexcept {
+    // Transfer the permit directly to the first waiter, if any
+    struct coroutine *coro = M_pop(&sema->waiters);
+    if (coro != nullptr) {
+        M_wakeup(coro);
+        return;
+    }
+
+    // Otherwise, make the permit available
+    MINIMK_ASSERT(sema->count < UINT64_MAX);
+    sema->count++;
+}
+
+template <decltype(minimk_runtime_sync_mutex_unlock) M_unlock = minimk_runtime_sync_mutex_unlock,
+          decltype(minimk_runtime_scheduler_coroutine_suspend_sync) M_suspend =
+                  minimk_runtime_scheduler_coroutine_suspend_sync,
+          decltype(minimk_runtime_sync_mutex_lock) M_lock = minimk_runtime_sync_mutex_lock>
+MINIMK_ALWAYS_INLINE void minimk_runtime_sync_cond_wait_impl(struct scheduler *sched,
+                                                             struct minimk_runtime_cond *cond,
+                                                             struct minimk_runtime_mutex *mutex) noexcept {
+    // Since coroutines are cooperative, no one can signal the condition between
+    // unlocking and suspending, which makes the release and wait atomic.
+    M_unlock(sched, mutex);
+    M_suspend(sched, &cond->waiters);
+    M_lock(sched, mutex);
+}
+
+template <decltype(minimk_runtime_waitlist_pop) M_pop = minimk_runtime_waitlist_pop,
+          decltype(minimk_runtime_coroutine_wakeup_sync) M_wakeup = minimk_runtime_coroutine_wakeup_sync>
+MINIMK_ALWAYS_INLINE void minimk_runtime_sync_cond_signal_impl(struct minimk_runtime_cond *cond) noexcept {
+    struct coroutine *coro = M_pop(&cond->waiters);
+    if (coro != nullptr) {
+        M_wakeup(coro);
+    }
+}
+
+template <decltype(minimk_runtime_waitlist_pop) M_pop = minimk_runtime_waitlist_pop,
+          decltype(minimk_runtime_coroutine_wakeup_sync) M_wakeup = minimk_runtime_coroutine_wakeup_sync>
+MINIMK_ALWAYS_INLINE void minimk_runtime_sync_cond_broadcast_impl(struct minimk_runtime_cond *cond) noexcept {
+    for (struct coroutine *coro = nullptr; (coro = M_pop(&cond->waiters)) != nullptr;) {
+        M_wakeup(coro);
+    }
+}
+
+#endif // LIBMINIMK_RUNTIME_SYNC_HPP
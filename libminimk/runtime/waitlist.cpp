@@ -0,0 +1,18 @@
+// File: libminimk/runtime/waitlist.cpp
+// Purpose: intrusive FIFO list of suspended coroutines
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "waitlist.hpp" // for minimk_runtime_waitlist_push_impl
+#include "waitlist.h"   // for struct minimk_runtime_waitlist
+
+void minimk_runtime_waitlist_push(struct minimk_runtime_waitlist *list, struct coroutine *coro) noexcept {
+    minimk_runtime_waitlist_push_impl(list, coro);
+}
+
+struct coroutine *minimk_runtime_waitlist_pop(struct minimk_runtime_waitlist *list) noexcept {
+    return minimk_runtime_waitlist_pop_impl(list);
+}
+
+void minimk_runtime_waitlist_remove(struct minimk_runtime_waitlist *list, struct coroutine *coro) noexcept {
+    minimk_runtime_waitlist_remove_impl(list, coro);
+}
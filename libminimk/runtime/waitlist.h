@@ -0,0 +1,25 @@
+// File: libminimk/runtime/waitlist.h
+// Purpose: intrusive FIFO list of suspended coroutines
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_WAITLIST_H
+#define LIBMINIMK_RUNTIME_WAITLIST_H
+
+#include <minimk/cdefs.h>   // for MINIMK_BEGIN_DECLS
+#include <minimk/runtime.h> // for struct minimk_runtime_waitlist
+
+MINIMK_BEGIN_DECLS
+
+/// Appends the coroutine, which must not belong to any list, to the list.
+void minimk_runtime_waitlist_push(struct minimk_runtime_waitlist *list,
+                                  struct coroutine *coro) MINIMK_NOEXCEPT;
+
+/// Removes and returns the first coroutine in the list or NULL if the list is empty.
+struct coroutine *minimk_runtime_waitlist_pop(struct minimk_runtime_waitlist *list) MINIMK_NOEXCEPT;
+
+/// Removes the coroutine, which must belong to the list, from the list.
+void minimk_runtime_waitlist_remove(struct minimk_runtime_waitlist *list,
+                                    struct coroutine *coro) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_RUNTIME_WAITLIST_H
@@ -0,0 +1,60 @@
+// File: libminimk/runtime/waitlist.hpp
+// Purpose: intrusive FIFO list of suspended coroutines
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_RUNTIME_WAITLIST_HPP
+#define LIBMINIMK_RUNTIME_WAITLIST_HPP
+
+#include "../cast/static.hpp" // for CAST_VOID_P
+
+#include "coroutine.h" // for struct coroutine
+#include "waitlist.h"  // for struct minimk_runtime_waitlist
+
+#include <minimk/assert.h> // for MINIMK_ASSERT
+#include <minimk/trace.h>  // for MINIMK_TRACE_COROUTINE
+
+static inline void minimk_runtime_waitlist_push_impl(struct minimk_runtime_waitlist *list,
+                                                     struct coroutine *coro) noexcept {
+    MINIMK_TRACE_COROUTINE("%p waitlist_push list=%p\n", CAST_VOID_P(coro), CAST_VOID_P(list));
+    MINIMK_ASSERT(coro->prev == nullptr && coro->next == nullptr && list->head != coro);
+
+    coro->prev = list->tail;
+    if (list->tail != nullptr) {
+        list->tail->next = coro;
+    } else {
+        list->head = coro;
+    }
+    list->tail = coro;
+}
+
+static inline void minimk_runtime_waitlist_remove_impl(struct minimk_runtime_waitlist *list,
+                                                       struct coroutine *coro) noexcept {
+    MINIMK_TRACE_COROUTINE("%p waitlist_remove list=%p\n", CAST_VOID_P(coro), CAST_VOID_P(list));
+
+    if (coro->prev != nullptr) {
+        coro->prev->next = coro->next;
+    } else {
+        MINIMK_ASSERT(list->head == coro);
+        list->head = coro->next;
+    }
+
+    if (coro->next != nullptr) {
+        coro->next->prev = coro->prev;
+    } else {
+        MINIMK_ASSERT(list->tail == coro);
+        list->tail = coro->prev;
+    }
+
+    coro->prev = nullptr;
+    coro->next = nullptr;
+}
+
+static inline struct coroutine *
+minimk_runtime_waitlist_pop_impl(struct minimk_runtime_waitlist *list) noexcept {
+    struct coroutine *coro = list->head;
+    if (coro != nullptr) {
+        minimk_runtime_waitlist_remove_impl(list, coro);
+    }
+    return coro;
+}
+
+#endif // LIBMINIMK_RUNTIME_WAITLIST_HPP
@@ -0,0 +1,17 @@
+// File: libminimk/slab/pool.cpp
+// Purpose: fixed-size object pools backed by page mappings
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "pool.h"   // for struct minimk_slab_pool
+#include "pool.hpp" // for minimk_slab_pool_alloc_impl
+
+#include <minimk/errno.h> // for minimk_error_t
+
+minimk_error_t minimk_slab_pool_alloc(struct minimk_slab_pool *pool, void **obj) noexcept {
+    return minimk_slab_pool_alloc_impl(pool, obj);
+}
+
+void minimk_slab_pool_free(struct minimk_slab_pool *pool, void *obj) noexcept {
+    *static_cast<void **>(obj) = pool->free;
+    pool->free = obj;
+}
@@ -0,0 +1,67 @@
+// File: libminimk/slab/pool.h
+// Purpose: fixed-size object pools backed by page mappings
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SLAB_POOL_H
+#define LIBMINIMK_SLAB_POOL_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+/// Alignment of every object handed out by a slab pool.
+#define MINIMK_SLAB_ALIGN static_cast<size_t>(16)
+
+/// Number of bytes we aim to map each time a size class pool is empty.
+#define MINIMK_SLAB_CHUNK_SIZE static_cast<size_t>(262144)
+
+/// Round an object size up to the size of its slab size class.
+///
+/// Each object must be able to hold the free list link.
+constexpr size_t minimk_slab_class_size(size_t size) noexcept {
+    return ((size < sizeof(void *) ? sizeof(void *) : size) + MINIMK_SLAB_ALIGN - 1) &
+           ~(MINIMK_SLAB_ALIGN - 1);
+}
+
+/// Return the minimum number of objects in each chunk of the given size class.
+constexpr size_t minimk_slab_class_per_chunk(size_t objsize) noexcept {
+    return (objsize < MINIMK_SLAB_CHUNK_SIZE) ? MINIMK_SLAB_CHUNK_SIZE / objsize : 1;
+}
+
+/// Pool of fixed-size objects.
+///
+/// The pool grows by mapping chunks of at least objsize * per_chunk bytes,
+/// rounded up to the page size, which we never unmap, so pointers to objects
+/// remain valid. Freed objects go on a LIFO free list threaded through their
+/// first word, so alloc and free are a few instructions and never call malloc.
+///
+/// Like the rest of the runtime, a pool is not thread safe.
+struct minimk_slab_pool {
+    /// First free object or NULL.
+    void *free;
+
+    /// Size of each object, which must be a size class.
+    size_t objsize;
+
+    /// Minimum number of objects in each chunk.
+    size_t per_chunk;
+
+    /// Number of chunks mapped so far.
+    size_t nchunks;
+};
+
+MINIMK_BEGIN_DECLS
+
+/// Take an object from the pool, mapping a new chunk when it is empty.
+///
+/// The object content is unspecified.
+///
+/// We return MINIMK_ENOMEM when we cannot map a new chunk.
+minimk_error_t minimk_slab_pool_alloc(struct minimk_slab_pool *pool, void **obj) MINIMK_NOEXCEPT;
+
+/// Return an object to the pool it came from.
+void minimk_slab_pool_free(struct minimk_slab_pool *pool, void *obj) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_SLAB_POOL_H
@@ -0,0 +1,93 @@
+// File: libminimk/slab/pool.hpp
+// Purpose: fixed-size object pools backed by page mappings
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SLAB_POOL_HPP
+#define LIBMINIMK_SLAB_POOL_HPP
+
+#include "../chunk/chunk.h" // for minimk_chunk_map
+
+#include "pool.h" // for struct minimk_slab_pool
+
+#include <minimk/cdefs.h> // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_slab_pool_alloc implementation.
+template <decltype(minimk_chunk_map) M_chunk_map = minimk_chunk_map>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_slab_pool_alloc_impl(struct minimk_slab_pool *pool,
+                                                                void **obj) noexcept {
+    *obj = nullptr;
+
+    // Grow the pool by one chunk, pushing its objects in address order
+    if (pool->free == nullptr) {
+        void *base = nullptr;
+        size_t mapped = 0;
+        minimk_error_t rv = M_chunk_map(&base, pool->objsize * pool->per_chunk, &mapped);
+        if (rv != 0) {
+            return rv;
+        }
+        // The mapping spans whole pages, so we also use the objects fitting in the tail
+        char *cursor = static_cast<char *>(base);
+        for (size_t idx = mapped / pool->objsize; idx > 0; idx--) {
+            MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+            void *entry = cursor + (idx - 1) * pool->objsize;
+            MINIMK_UNSAFE_BUFFER_USAGE_END
+            *static_cast<void **>(entry) = pool->free;
+            pool->free = entry;
+        }
+        pool->nchunks++;
+    }
+
+    // Pop the first free object
+    void *entry = pool->free;
+    pool->free = *static_cast<void **>(entry);
+    *obj = entry;
+    return 0;
+}
+
+/// Return the process-wide pool for objects of the given size class.
+template <size_t M_objsize>
+MINIMK_ALWAYS_INLINE struct minimk_slab_pool *minimk_slab_pool_for_class() noexcept {
+    static_assert(M_objsize == minimk_slab_class_size(M_objsize), "M_objsize must be a size class");
+    static struct minimk_slab_pool pool = {nullptr, M_objsize, minimk_slab_class_per_chunk(M_objsize), 0};
+    return &pool;
+}
+
+/// Like minimk_slab_pool_for_class but returns a pool private to the calling thread.
+///
+/// Use this pool when several threads each run their own runtime, so that
+/// allocation never contends across threads. Objects must be freed to the
+/// pool of the thread that allocated them.
+template <size_t M_objsize>
+MINIMK_ALWAYS_INLINE struct minimk_slab_pool *minimk_slab_pool_for_thread_class() noexcept {
+    static_assert(M_objsize == minimk_slab_class_size(M_objsize), "M_objsize must be a size class");
+    static thread_local struct minimk_slab_pool pool = {nullptr, M_objsize,
+                                                        minimk_slab_class_per_chunk(M_objsize), 0};
+    return &pool;
+}
+
+/// Like minimk_slab_pool_for_size but returns a pool private to the calling thread.
+template <size_t M_size>
+MINIMK_ALWAYS_INLINE struct minimk_slab_pool *minimk_slab_pool_for_thread() noexcept {
+    return minimk_slab_pool_for_thread_class<minimk_slab_class_size(M_size)>();
+}
+
+/// Return the pool for objects of the given size.
+///
+/// We key pools by size class, so objects whose sizes round to the same
+/// size class share the same pool and free list.
+///
+/// The pool is process-wide unless we are compiled with the opt-in
+/// MINIMK_FEATURE_SLAB_THREAD_CACHE, in which case each thread has its own
+/// pool and must free the objects it allocates.
+template <size_t M_size>
+MINIMK_ALWAYS_INLINE struct minimk_slab_pool *minimk_slab_pool_for_size() noexcept {
+#ifdef MINIMK_FEATURE_SLAB_THREAD_CACHE
+    return minimk_slab_pool_for_thread<M_size>();
+#else
+    return minimk_slab_pool_for_class<minimk_slab_class_size(M_size)>();
+#endif
+}
+
+#endif // LIBMINIMK_SLAB_POOL_HPP
@@ -0,0 +1,39 @@
+// File: libminimk/slab/table.cpp
+// Purpose: fixed-size object tables addressed by index
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "table.h"   // for struct minimk_slab_table
+#include "table.hpp" // for minimk_slab_table_alloc_impl
+
+#include <minimk/assert.h> // for MINIMK_ASSERT
+#include <minimk/cdefs.h>  // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/errno.h>  // for minimk_error_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+size_t minimk_slab_table_capacity(const struct minimk_slab_table *table) noexcept {
+    return table->nchunks * table->per_chunk;
+}
+
+void *minimk_slab_table_get(struct minimk_slab_table *table, size_t idx) noexcept {
+    MINIMK_ASSERT(idx < minimk_slab_table_capacity(table));
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    char *base = static_cast<char *>(table->chunks[idx / table->per_chunk]);
+    return base + (idx % table->per_chunk) * table->objsize;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+minimk_error_t minimk_slab_table_alloc(struct minimk_slab_table *table, uint32_t *idx) noexcept {
+    return minimk_slab_table_alloc_impl(table, idx);
+}
+
+void minimk_slab_table_free(struct minimk_slab_table *table, uint32_t idx) noexcept {
+    *minimk_slab_table_link(table, minimk_slab_table_get(table, idx)) = MINIMK_SLAB_TABLE_NONE;
+    if (table->free_tail == MINIMK_SLAB_TABLE_NONE) {
+        table->free_head = idx;
+    } else {
+        *minimk_slab_table_link(table, minimk_slab_table_get(table, table->free_tail)) = idx;
+    }
+    table->free_tail = idx;
+}
@@ -0,0 +1,78 @@
+// File: libminimk/slab/table.h
+// Purpose: fixed-size object tables addressed by index
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SLAB_TABLE_H
+#define LIBMINIMK_SLAB_TABLE_H
+
+#include <minimk/cdefs.h> // for MINIMK_BEGIN_DECLS
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t, UINT32_MAX
+
+/// Sentinel index indicating the end of a table free list.
+#define MINIMK_SLAB_TABLE_NONE UINT32_MAX
+
+/// Table of fixed-size objects addressed by a dense index.
+///
+/// Like a pool, the table grows by mapping zero-initialized chunks of
+/// objsize * per_chunk bytes, which we never unmap, so pointers to objects
+/// remain valid. Unlike a pool, each object has a stable index, which we can
+/// pack into a handle, and the free list is FIFO, so we reuse a freed index
+/// only after all the other free ones.
+///
+/// The free list link is the uint32_t at link_offset inside each object,
+/// which is only meaningful while the object is free. The owner clears the
+/// rest of the object, except the state it wants to preserve across reuse,
+/// such as a generation counter.
+///
+/// Like the rest of the runtime, a table is not thread safe.
+struct minimk_slab_table {
+    /// Caller-provided array of max_chunks chunk addresses.
+    void **chunks;
+
+    /// Maximum number of chunks in the table.
+    size_t max_chunks;
+
+    /// Size of each object.
+    size_t objsize;
+
+    /// Number of objects in each chunk.
+    size_t per_chunk;
+
+    /// Offset of the uint32_t free list link inside each object.
+    size_t link_offset;
+
+    /// Number of chunks mapped so far.
+    size_t nchunks;
+
+    /// Oldest free object, which is the next object we allocate.
+    uint32_t free_head;
+
+    /// Newest free object, after which we append freed objects.
+    uint32_t free_tail;
+};
+
+MINIMK_BEGIN_DECLS
+
+/// Return the number of objects in the chunks mapped so far.
+size_t minimk_slab_table_capacity(const struct minimk_slab_table *table) MINIMK_NOEXCEPT;
+
+/// Return the object with the given index, which must be lower than the capacity.
+void *minimk_slab_table_get(struct minimk_slab_table *table, size_t idx) MINIMK_NOEXCEPT;
+
+/// Take the oldest free object, mapping a new chunk when none is free.
+///
+/// The idx argument is set to MINIMK_SLAB_TABLE_NONE when the function is
+/// called and later changed to the index of the object on success.
+///
+/// We return MINIMK_EMFILE when the table already has max_chunks chunks and
+/// MINIMK_ENOMEM when we cannot map a new chunk.
+minimk_error_t minimk_slab_table_alloc(struct minimk_slab_table *table, uint32_t *idx) MINIMK_NOEXCEPT;
+
+/// Return an object to the tail of the free list.
+void minimk_slab_table_free(struct minimk_slab_table *table, uint32_t idx) MINIMK_NOEXCEPT;
+
+MINIMK_END_DECLS
+
+#endif // LIBMINIMK_SLAB_TABLE_H
@@ -0,0 +1,62 @@
+// File: libminimk/slab/table.hpp
+// Purpose: fixed-size object tables addressed by index
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SLAB_TABLE_HPP
+#define LIBMINIMK_SLAB_TABLE_HPP
+
+#include "../chunk/chunk.h" // for minimk_chunk_map
+
+#include "table.h" // for struct minimk_slab_table
+
+#include <minimk/cdefs.h> // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h> // for minimk_error_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Return the free list link of the given object.
+static inline uint32_t *minimk_slab_table_link(struct minimk_slab_table *table, void *obj) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return static_cast<uint32_t *>(static_cast<void *>(static_cast<char *>(obj) + table->link_offset));
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+/// Testable minimk_slab_table_alloc implementation.
+template <decltype(minimk_chunk_map) M_chunk_map = minimk_chunk_map>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_slab_table_alloc_impl(struct minimk_slab_table *table,
+                                                                 uint32_t *idx) noexcept {
+    *idx = MINIMK_SLAB_TABLE_NONE;
+
+    // When all the objects are busy, make room using a new chunk
+    if (table->free_head == MINIMK_SLAB_TABLE_NONE) {
+        if (table->nchunks >= table->max_chunks) {
+            return MINIMK_EMFILE;
+        }
+        void *base = nullptr;
+        size_t mapped = 0;
+        minimk_error_t rv = M_chunk_map(&base, table->objsize * table->per_chunk, &mapped);
+        if (rv != 0) {
+            return rv;
+        }
+
+        // Append the chunk and make its objects available in index order
+        size_t capacity = minimk_slab_table_capacity(table);
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        table->chunks[table->nchunks++] = base;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        for (size_t entry = capacity; entry < minimk_slab_table_capacity(table); entry++) {
+            minimk_slab_table_free(table, static_cast<uint32_t>(entry));
+        }
+    }
+
+    // Pop the oldest free object
+    uint32_t head = table->free_head;
+    table->free_head = *minimk_slab_table_link(table, minimk_slab_table_get(table, head));
+    if (table->free_head == MINIMK_SLAB_TABLE_NONE) {
+        table->free_tail = MINIMK_SLAB_TABLE_NONE;
+    }
+    *idx = head;
+    return 0;
+}
+
+#endif // LIBMINIMK_SLAB_TABLE_HPP
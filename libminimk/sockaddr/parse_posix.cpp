@@ -0,0 +1,12 @@
+// File: libminimk/sockaddr/parse_posix.cpp
+// Purpose: parsing numeric socket addresses on POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "parse_posix.hpp" // for minimk_sockaddr_parse_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_parse
+
+minimk_error_t minimk_sockaddr_parse(minimk_sockaddr_t *sa, const char *address, const char *port) noexcept {
+    return minimk_sockaddr_parse_impl(sa, address, port);
+}
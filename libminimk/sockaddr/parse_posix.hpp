@@ -0,0 +1,135 @@
+// File: libminimk/sockaddr/parse_posix.hpp
+// Purpose: parsing numeric socket addresses on POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKADDR_PARSE_POSIX_HPP
+#define LIBMINIMK_SOCKADDR_PARSE_POSIX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+
+#include <arpa/inet.h>  // for inet_pton
+#include <net/if.h>     // for if_nametoindex
+#include <netinet/in.h> // for struct sockaddr_in6
+#include <sys/socket.h> // for AF_INET
+
+#include <stdint.h> // for uint16_t
+#include <string.h> // for memcpy, strchr, strlen
+
+static_assert(sizeof(sockaddr_in) <= sizeof(minimk_sockaddr_t::storage), "storage too small for sockaddr_in");
+static_assert(sizeof(sockaddr_in6) <= sizeof(minimk_sockaddr_t::storage), //
+              "storage too small for sockaddr_in6");
+
+/// Parses a decimal port number, rejecting empty strings, signs, and overflows.
+static inline minimk_error_t minimk_sockaddr_parse_port(const char *port, uint16_t *value) noexcept {
+    uint32_t accum = 0;
+    size_t idx = 0;
+    for (;; idx++) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        char ch = port[idx];
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        if (ch == '\0') {
+            break;
+        }
+        if (ch < '0' || ch > '9' || idx >= 5) {
+            return MINIMK_EINVAL;
+        }
+        accum = (accum * 10) + static_cast<uint32_t>(ch - '0');
+    }
+    if (idx <= 0 || accum > UINT16_MAX) {
+        return MINIMK_EINVAL;
+    }
+    *value = static_cast<uint16_t>(accum);
+    return 0;
+}
+
+/// Parses the scope of a scoped IPv6 literal, either an interface name or an index.
+template <decltype(if_nametoindex) M_libc_if_nametoindex = if_nametoindex>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_sockaddr_parse_scope(const char *scope, uint32_t *value) noexcept {
+    // Accept a decimal interface index, which needs no lookup
+    uint64_t accum = 0;
+    size_t idx = 0;
+    for (;; idx++) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        char ch = scope[idx];
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        if (ch < '0' || ch > '9' || idx >= 10) {
+            break;
+        }
+        accum = (accum * 10) + static_cast<uint64_t>(ch - '0');
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    bool numeric = idx > 0 && scope[idx] == '\0' && accum <= UINT32_MAX;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    if (numeric) {
+        *value = static_cast<uint32_t>(accum);
+        return 0;
+    }
+
+    // Otherwise resolve the interface name to its index
+    unsigned int index = M_libc_if_nametoindex(scope);
+    if (index <= 0) {
+        return MINIMK_EINVAL;
+    }
+    *value = static_cast<uint32_t>(index);
+    return 0;
+}
+
+/// Testable minimk_sockaddr_parse implementation.
+template <decltype(inet_pton) M_libc_inet_pton = inet_pton,
+          decltype(if_nametoindex) M_libc_if_nametoindex = if_nametoindex>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_sockaddr_parse_impl(minimk_sockaddr_t *sa, const char *address,
+                                                               const char *port) noexcept {
+    // Zero the output argument immediately
+    *sa = {};
+
+    // Parse the port first since it is shared by both families
+    uint16_t portnum = 0;
+    if (minimk_sockaddr_parse_port(port, &portnum) != 0) {
+        return MINIMK_EINVAL;
+    }
+
+    // Attempt to parse as IPv4 first, which is the common case
+    sockaddr_in sin{};
+    if (M_libc_inet_pton(AF_INET, address, &sin.sin_addr) == 1) {
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons(portnum);
+        memcpy(sa->storage, &sin, sizeof(sin));
+        sa->length = static_cast<uint32_t>(sizeof(sin));
+        return 0;
+    }
+
+    // Then attempt to parse as IPv6, splitting off the scope of literals
+    // such as "fe80::1%eth0", which inet_pton does not understand
+    sockaddr_in6 sin6{};
+    const char *percent = strchr(address, '%');
+    if (percent != nullptr) {
+        char literal[INET6_ADDRSTRLEN];
+        size_t len = static_cast<size_t>(percent - address);
+        if (len >= sizeof(literal)) {
+            return MINIMK_EINVAL;
+        }
+        memcpy(literal, address, len);
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        literal[len] = '\0';
+        const char *scope = percent + 1;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        uint32_t scope_id = 0;
+        if (M_libc_inet_pton(AF_INET6, literal, &sin6.sin6_addr) != 1 ||
+            minimk_sockaddr_parse_scope<M_libc_if_nametoindex>(scope, &scope_id) != 0) {
+            return MINIMK_EINVAL;
+        }
+        sin6.sin6_scope_id = scope_id;
+    }
+    if (percent != nullptr || M_libc_inet_pton(AF_INET6, address, &sin6.sin6_addr) == 1) {
+        sin6.sin6_family = AF_INET6;
+        sin6.sin6_port = htons(portnum);
+        memcpy(sa->storage, &sin6, sizeof(sin6));
+        sa->length = static_cast<uint32_t>(sizeof(sin6));
+        return 0;
+    }
+
+    return MINIMK_EINVAL;
+}
+
+#endif // LIBMINIMK_SOCKADDR_PARSE_POSIX_HPP
@@ -4,100 +4,19 @@
 #ifndef LIBMINIMK_SOCKET_ACCEPT_HPP
 #define LIBMINIMK_SOCKET_ACCEPT_HPP
 
-#include "../cast/static.hpp" // for CAST_ULL
+#include <minimk/cdefs.h>  // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_accept_many
 
-#include "info.hpp" // for struct socket_info
-
-#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
-#include <minimk/errno.h>   // for minimk_error_t
-#include <minimk/runtime.h> // for minimk_runtime_suspend_*
-#include <minimk/socket.h>  // for minimk_socket_t
-#include <minimk/syscall.h> // for minimk_syscall_*
-#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+#include <stddef.h> // for size_t
 
 /// Testable minimk_socket_accept implementation.
-template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
-          decltype(minimk_syscall_accept) M_accept = minimk_syscall_accept,
-          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read,
-          decltype(minimk_syscall_socket_setnonblock) M_setnonblock = minimk_syscall_socket_setnonblock,
-          decltype(minimk_syscall_setsockopt_nosigpipe) M_nosigpipe = minimk_syscall_setsockopt_nosigpipe,
-          decltype(minimk_syscall_closesocket) M_closesocket = minimk_syscall_closesocket,
-          decltype(minimk_socket_info_create) M_info_create = minimk_socket_info_create>
+template <decltype(minimk_socket_accept_many) M_accept_many = minimk_socket_accept_many>
 MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_accept_impl(minimk_socket_t *client_sock,
                                                               minimk_socket_t listener_sock) noexcept {
-    MINIMK_TRACE_SOCKET("accept listenerfd=0x%llx\n", CAST_ULL(listener_sock));
-
-    // Invalidate the handle, as documented
-    *client_sock = MINIMK_SOCKET_INVALID;
-
-    // Find the corresponding info
-    socket_info *listener_info = nullptr;
-    minimk_error_t rv = M_info_find(&listener_info, listener_sock);
-    if (rv != 0) {
-        MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
-        return rv;
-    }
-
-    MINIMK_TRACE_SOCKET("accept fd=%llu\n", CAST_ULL(listener_info->fd));
-    MINIMK_TRACE_SOCKET("accept read_timeout=%llu\n", CAST_ULL(listener_info->read_timeout));
-
-    for (;;) {
-        // Attempt to accept a connection
-        minimk_syscall_socket_t client_fd = minimk_syscall_invalid_socket;
-        rv = M_accept(&client_fd, listener_info->fd);
-
-        MINIMK_TRACE_SOCKET("accept syscall_result=%s\n", minimk_errno_name(rv));
-
-        // Suspend if needed
-        if (rv == MINIMK_EAGAIN) {
-            MINIMK_TRACE_SOCKET("accept suspend_read fd=%llu\n", CAST_ULL(listener_info->fd));
-            MINIMK_TRACE_SOCKET("accept suspend_read timeout=%llu\n", CAST_ULL(listener_info->read_timeout));
-            rv = M_suspend_read(listener_info->fd, listener_info->read_timeout);
-            if (rv != 0) {
-                MINIMK_TRACE_SOCKET("accept suspend_read result=%s\n", minimk_errno_name(rv));
-                MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
-                return rv;
-            }
-            MINIMK_TRACE_SOCKET("accept resumed fd=%llu\n", CAST_ULL(listener_info->fd));
-            continue;
-        }
-
-        // Handle any other kind of errors
-        if (rv != 0) {
-            MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
-            return rv;
-        }
-
-        // Make socket nonblocking
-        MINIMK_TRACE_SOCKET("accept clientfd=%llu\n", CAST_ULL(client_fd));
-        rv = M_setnonblock(client_fd);
-        if (rv != 0) {
-            MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
-            M_closesocket(&client_fd);
-            return rv;
-        }
-
-        // Set SO_NOSIGPIPE when available (FreeBSD/macOS) for defense-in-depth SIGPIPE prevention
-        MINIMK_TRACE_SOCKET("accept setsockopt_nosigpipe clientfd=%llu\n", CAST_ULL(client_fd));
-        rv = M_nosigpipe(client_fd);
-        MINIMK_TRACE_SOCKET("accept setsockopt_nosigpipe result=%s\n", minimk_errno_name(rv));
-        // Note: we don't fail on SO_NOSIGPIPE failure (same reasoning as in create)
-
-        // Create the corresponding socketinfo
-        socket_info *client_info = nullptr;
-        rv = M_info_create(&client_info, client_fd);
-        if (rv != 0) {
-            MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
-            M_closesocket(&client_fd);
-            return rv;
-        }
-
-        // Return the socket handle to the caller
-        *client_sock = client_info->handle;
-        MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(0));
-        MINIMK_TRACE_SOCKET("accept client_handle=0x%llx\n", CAST_ULL(*client_sock));
-        return 0;
-    }
+    // Accepting a single connection is a batch of size one
+    size_t naccepted = 0;
+    return M_accept_many(client_sock, 1, &naccepted, listener_sock);
 }
 
 #endif // LIBMINIMK_SOCKET_ACCEPT_HPP
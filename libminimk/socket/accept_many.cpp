@@ -0,0 +1,15 @@
+// File: libminimk/socket/accept_many.cpp
+// Purpose: implements accept_many
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "accept_many.hpp" // for minimk_socket_accept_many_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_accept_many(minimk_socket_t *client_socks, size_t count, size_t *naccepted,
+                                         minimk_socket_t listener_sock) noexcept {
+    return minimk_socket_accept_many_impl(client_socks, count, naccepted, listener_sock);
+}
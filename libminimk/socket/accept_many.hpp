@@ -0,0 +1,132 @@
+// File: libminimk/socket/accept_many.hpp
+// Purpose: implements accept_many
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_ACCEPT_MANY_HPP
+#define LIBMINIMK_SOCKET_ACCEPT_MANY_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_accept_many implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_accept_nonblock) M_accept = minimk_syscall_accept_nonblock,
+          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read,
+          decltype(minimk_syscall_setsockopt_nosigpipe) M_nosigpipe = minimk_syscall_setsockopt_nosigpipe,
+          decltype(minimk_syscall_closesocket) M_closesocket = minimk_syscall_closesocket,
+          decltype(minimk_socket_info_create) M_info_create = minimk_socket_info_create>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_socket_accept_many_impl(minimk_socket_t *client_socks, size_t count, size_t *naccepted,
+                               minimk_socket_t listener_sock) noexcept {
+    MINIMK_TRACE_SOCKET("accept listenerfd=0x%llx\n", CAST_ULL(listener_sock));
+    MINIMK_TRACE_SOCKET("accept count=%zu\n", count);
+
+    // Invalidate the handles, as documented
+    *naccepted = 0;
+    for (size_t idx = 0; idx < count; idx++) {
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        client_socks[idx] = MINIMK_SOCKET_INVALID;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+    }
+
+    // As documented, reject empty batches
+    if (count <= 0) {
+        MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(MINIMK_EINVAL));
+        return MINIMK_EINVAL;
+    }
+
+    // Find the corresponding info
+    socket_info *listener_info = nullptr;
+    minimk_error_t rv = M_info_find(&listener_info, listener_sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("accept fd=%llu\n", CAST_ULL(listener_info->fd));
+    MINIMK_TRACE_SOCKET("accept read_timeout=%llu\n", CAST_ULL(listener_info->read_timeout));
+
+    while (*naccepted < count) {
+        // Attempt to accept a connection unless we know there are none pending
+        minimk_syscall_socket_t client_fd = minimk_syscall_invalid_socket;
+        rv = MINIMK_EAGAIN;
+        if ((listener_info->flags & SOCKET_INFO_FLAG_READABLE) != 0) {
+            rv = M_accept(&client_fd, listener_info->fd);
+            MINIMK_TRACE_SOCKET("accept syscall_result=%s\n", minimk_errno_name(rv));
+        }
+
+        // Remember that the backlog is empty
+        if (rv == MINIMK_EAGAIN) {
+            listener_info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
+        }
+
+        // Once we have accepted some connections, we stop at the first error and defer
+        // reporting it to the next call, which would most likely fail again.
+        if (rv != 0 && *naccepted > 0) {
+            break;
+        }
+
+        // Suspend if needed
+        if (rv == MINIMK_EAGAIN) {
+            MINIMK_TRACE_SOCKET("accept suspend_read fd=%llu\n", CAST_ULL(listener_info->fd));
+            MINIMK_TRACE_SOCKET("accept suspend_read timeout=%llu\n", CAST_ULL(listener_info->read_timeout));
+            rv = M_suspend_read(listener_info->fd, listener_info->read_timeout);
+            if (rv != 0) {
+                MINIMK_TRACE_SOCKET("accept suspend_read result=%s\n", minimk_errno_name(rv));
+                MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+            MINIMK_TRACE_SOCKET("accept resumed fd=%llu\n", CAST_ULL(listener_info->fd));
+            listener_info->flags |= SOCKET_INFO_FLAG_READABLE;
+            continue;
+        }
+
+        // Handle any other kind of errors
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+
+        // Set SO_NOSIGPIPE when available (FreeBSD/macOS) for defense-in-depth SIGPIPE prevention
+        MINIMK_TRACE_SOCKET("accept clientfd=%llu\n", CAST_ULL(client_fd));
+        MINIMK_TRACE_SOCKET("accept setsockopt_nosigpipe clientfd=%llu\n", CAST_ULL(client_fd));
+        rv = M_nosigpipe(client_fd);
+        MINIMK_TRACE_SOCKET("accept setsockopt_nosigpipe result=%s\n", minimk_errno_name(rv));
+        // Note: we don't fail on SO_NOSIGPIPE failure (same reasoning as in create)
+
+        // Create the corresponding socketinfo
+        socket_info *client_info = nullptr;
+        rv = M_info_create(&client_info, client_fd);
+        if (rv != 0) {
+            M_closesocket(&client_fd);
+            if (*naccepted > 0) {
+                break;
+            }
+            MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+
+        // Return the socket handle to the caller
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        client_socks[*naccepted] = client_info->handle;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        MINIMK_TRACE_SOCKET("accept client_handle=0x%llx\n", CAST_ULL(client_info->handle));
+        (*naccepted)++;
+    }
+
+    MINIMK_TRACE_SOCKET("accept result=%s\n", minimk_errno_name(0));
+    MINIMK_TRACE_SOCKET("accept naccepted=%zu\n", *naccepted);
+    return 0;
+}
+
+#endif // LIBMINIMK_SOCKET_ACCEPT_MANY_HPP
@@ -0,0 +1,13 @@
+// File: libminimk/socket/bind_addr.cpp
+// Purpose: bind_addr implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "bind_addr.hpp" // for minimk_socket_bind_addr_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+
+minimk_error_t minimk_socket_bind_addr(minimk_socket_t sock, const minimk_sockaddr_t *sa) noexcept {
+    return minimk_socket_bind_addr_impl(sock, sa);
+}
@@ -0,0 +1,39 @@
+// File: libminimk/socket/bind_addr.hpp
+// Purpose: bind_addr implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_BIND_ADDR_HPP
+#define LIBMINIMK_SOCKET_BIND_ADDR_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+#include <minimk/syscall.h>  // for minimk_syscall_*
+#include <minimk/trace.h>    // for MINIMK_TRACE_SOCKET
+
+/// Testable minimk_socket_bind_addr implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_bind_addr) M_bind = minimk_syscall_bind_addr>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_bind_addr_impl(minimk_socket_t sock,
+                                                                 const minimk_sockaddr_t *sa) noexcept {
+    MINIMK_TRACE_SOCKET("bind handle=0x%llx\n", CAST_ULL(sock));
+
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("bind result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("bind fd=%llu\n", CAST_ULL(info->fd));
+    rv = M_bind(info->fd, sa);
+
+    MINIMK_TRACE_SOCKET("bind result=%s\n", minimk_errno_name(rv));
+    return rv;
+}
+
+#endif // LIBMINIMK_SOCKET_BIND_ADDR_HPP
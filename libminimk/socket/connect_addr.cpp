@@ -0,0 +1,13 @@
+// File: libminimk/socket/connect_addr.cpp
+// Purpose: connect_addr implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "connect_addr.hpp" // for minimk_socket_connect_addr_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+
+minimk_error_t minimk_socket_connect_addr(minimk_socket_t sock, const minimk_sockaddr_t *sa) noexcept {
+    return minimk_socket_connect_addr_impl(sock, sa);
+}
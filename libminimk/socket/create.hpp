@@ -15,8 +15,7 @@
 #include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
 
 /// Testable minimk_socket_create implementation.
-template <decltype(minimk_syscall_socket) M_socket = minimk_syscall_socket,
-          decltype(minimk_syscall_socket_setnonblock) M_setnonblock = minimk_syscall_socket_setnonblock,
+template <decltype(minimk_syscall_socket_nonblock) M_socket = minimk_syscall_socket_nonblock,
           decltype(minimk_syscall_setsockopt_nosigpipe) M_nosigpipe = minimk_syscall_setsockopt_nosigpipe,
           decltype(minimk_syscall_closesocket) M_closesocket = minimk_syscall_closesocket,
           decltype(minimk_socket_info_create) M_info_create = minimk_socket_info_create>
@@ -25,7 +24,7 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_create_impl(minimk_socket_t *s
     // Invalidate the handle, as documented
     *sock = MINIMK_SOCKET_INVALID;
 
-    // Create the underlying socket
+    // Create the underlying nonblocking socket
     MINIMK_TRACE_SOCKET("socket domain=%d type=%d protocol=%d\n", domain, type, protocol);
 
     minimk_syscall_socket_t sockfd = minimk_syscall_invalid_socket;
@@ -37,17 +36,6 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_create_impl(minimk_socket_t *s
         return rv;
     }
 
-    // Make it nonblocking
-    MINIMK_TRACE_SOCKET("setnonblock fd=%llu\n", CAST_ULL(sockfd));
-
-    rv = M_setnonblock(sockfd);
-    MINIMK_TRACE_SOCKET("setnonblock result=%s\n", minimk_errno_name(rv));
-
-    if (rv != 0) {
-        M_closesocket(&sockfd);
-        return rv;
-    }
-
     // Set SO_NOSIGPIPE when available (FreeBSD/macOS) for defense-in-depth SIGPIPE prevention
     MINIMK_TRACE_SOCKET("setsockopt_nosigpipe fd=%llu\n", CAST_ULL(sockfd));
 
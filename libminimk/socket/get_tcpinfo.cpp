@@ -0,0 +1,13 @@
+// File: libminimk/socket/get_tcpinfo.cpp
+// Purpose: get_tcpinfo implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "get_tcpinfo.hpp" // for minimk_socket_get_tcpinfo_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_t
+
+minimk_error_t minimk_socket_get_tcpinfo(minimk_socket_t sock, minimk_tcpinfo_t *info) noexcept {
+    return minimk_socket_get_tcpinfo_impl(sock, info);
+}
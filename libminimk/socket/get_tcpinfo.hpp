@@ -0,0 +1,44 @@
+// File: libminimk/socket/get_tcpinfo.hpp
+// Purpose: get_tcpinfo implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_GET_TCPINFO_HPP
+#define LIBMINIMK_SOCKET_GET_TCPINFO_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_t
+#include <minimk/time.h>    // for minimk_time_monotonic_now
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+/// Testable minimk_socket_get_tcpinfo implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_getsockopt_tcp_info) M_getsockopt_tcp_info =
+                  minimk_syscall_getsockopt_tcp_info,
+          decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_get_tcpinfo_impl(minimk_socket_t sock,
+                                                                   minimk_tcpinfo_t *tinfo) noexcept {
+    MINIMK_TRACE_SOCKET("get_tcpinfo handle=0x%llx\n", CAST_ULL(sock));
+    *tinfo = {};
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("get_tcpinfo result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    // Read the statistics and timestamp them
+    rv = M_getsockopt_tcp_info(info->fd, tinfo);
+    tinfo->time = M_now();
+    MINIMK_TRACE_SOCKET("get_tcpinfo result=%s\n", minimk_errno_name(rv));
+    return rv;
+}
+
+#endif // LIBMINIMK_SOCKET_GET_TCPINFO_HPP
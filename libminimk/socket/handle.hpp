@@ -7,7 +7,7 @@
 #include <minimk/assert.h> // for MINIMK_ASSERT
 #include <minimk/cdefs.h>  // for MINIMK_BEGIN_DECLS
 
-#include <stdint.h> // for uint8_t
+#include <stdint.h> // for uint8_t, uint32_t
 
 /*-
   Handles
@@ -16,22 +16,27 @@
   Externally, we represent handles using uint64_t. The zero
   handles is the canonically invalid handle.
 
-  We never reuse socket IDs. Each new allocation uses the
-  next available ID. Until we run out of handle IDs.
+  We never quickly reuse socket IDs. Released slots are reused
+  in FIFO order and with a new generation, so the same ID comes
+  back only when a slot generation wraps around.
 
   Each handle contains the following information:
 
-   64---------56---------------8----------0
-    | type: 8 | generation: 48 | index: 8 |
-    +---------+----------------+----------+
+   64---------56---------------24---------0
+    | type: 8 | generation: 32 | index: 24 |
+    +---------+----------------+-----------+
 
   Where type is the handle type, generation is the generation
   to which the handle belongs, index is the index inside the
   handle table used for that handle type.
+
+  Each slot has its own generation, which changes every time
+  the slot is released, therefore a stale handle whose slot has
+  been reused does not match the handle stored in the slot.
 */
 
 /// The maximum number of handles we can store in a table.
-#define MAX_HANDLES 256
+#define MAX_HANDLES (1 << 24)
 
 /// The invalid handle type
 #define HANDLE_TYPE_NULL 0
@@ -47,32 +52,32 @@ static inline uint8_t handle_type(uint64_t handle) MINIMK_NOEXCEPT {
 }
 
 /// Function to extract the generation from a handle.
-static inline uint64_t handle_generation(uint64_t handle) MINIMK_NOEXCEPT {
-    return (handle & 0x00ffffffffffff00) >> 8;
+static inline uint32_t handle_generation(uint64_t handle) MINIMK_NOEXCEPT {
+    return static_cast<uint32_t>((handle & 0x00ffffffff000000) >> 24);
 }
 
 /// Function to extract the index from a handle.
-static inline uint64_t handle_index(uint64_t handle) MINIMK_NOEXCEPT {
-    return (handle & 0x00000000000000ff);
+static inline uint32_t handle_index(uint64_t handle) MINIMK_NOEXCEPT {
+    return static_cast<uint32_t>(handle & 0x0000000000ffffff);
 }
 
-/// Function returning whether a given generation value is valid.
-static inline int handle_generation_valid(uint64_t generation) MINIMK_NOEXCEPT {
-    return (generation & 0xffff000000000000) == 0;
+/// Function returning whether a given index value is valid.
+static inline int handle_index_valid(uint32_t index) MINIMK_NOEXCEPT {
+    return index < MAX_HANDLES;
 }
 
 /// Function to create a handle given type, generation, and index.
-static inline uint64_t make_handle(uint8_t type, uint64_t generation, uint8_t index) MINIMK_NOEXCEPT {
+static inline uint64_t make_handle(uint8_t type, uint32_t generation, uint32_t index) MINIMK_NOEXCEPT {
     uint64_t handle = 0;
 
     // Add the handle type
     handle |= (static_cast<uint64_t>(type)) << 56;
 
     // Add the handle generation
-    MINIMK_ASSERT(handle_generation_valid(generation));
-    handle |= generation << 8;
+    handle |= (static_cast<uint64_t>(generation)) << 24;
 
     // Add the handle index
+    MINIMK_ASSERT(handle_index_valid(index));
     handle |= static_cast<uint64_t>(index);
 
     return handle;
@@ -3,34 +3,43 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "../cast/static.hpp" // for CAST_ULL
+#include "../slab/table.h"    // for struct minimk_slab_table
 
 #include "handle.hpp" // for make_handle
 #include "info.hpp"   // for struct socket_info
 
 #include <minimk/assert.h>  // for MINIMK_ASSERT
-#include <minimk/cdefs.h>   // for MINIMK_UNSAFE_BUFFER_USAGE_*
 #include <minimk/errno.h>   // for minimk_error_t
 #include <minimk/socket.h>  // for minimk_socket_t
 #include <minimk/syscall.h> // for minimk_syscall_*
 #include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
 
-#include <stddef.h> // for size_t
+#include <stddef.h> // for size_t, offsetof
 #include <stdint.h> // for UINT64_MAX
 
-/// Global socket table managed by the runtime.
-static socket_info sockets[MAX_SOCKETS];
-
-/// Global generation counter - incremented each time we wrap around the table.
-static uint64_t generation = 0;
-
-/// Next slot to try allocating from.
-static size_t next_slot = 0;
+/// Addresses of the chunks of the socket table.
+static void *chunks[MAX_SOCKET_INFO_CHUNKS];
+
+/// Global socket table managed by the runtime, allocated one chunk at a time.
+///
+/// The table never unmaps chunks, so the address of an entry remains stable.
+static struct minimk_slab_table table = {
+        chunks,
+        MAX_SOCKET_INFO_CHUNKS,
+        sizeof(socket_info),
+        SOCKET_INFO_CHUNK_SIZE,
+        offsetof(socket_info, next_free),
+        0,
+        MINIMK_SLAB_TABLE_NONE,
+        MINIMK_SLAB_TABLE_NONE,
+};
+
+size_t minimk_socket_info_capacity(void) noexcept {
+    return minimk_slab_table_capacity(&table);
+}
 
 socket_info *minimk_socket_info_get(size_t idx) noexcept {
-    MINIMK_ASSERT(idx >= 0 && idx < MAX_SOCKETS);
-    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
-    return &sockets[idx];
-    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return static_cast<socket_info *>(minimk_slab_table_get(&table, idx));
 }
 
 minimk_error_t minimk_socket_info_find(socket_info **pinfo, minimk_socket_t handle) noexcept {
@@ -43,7 +52,7 @@ minimk_error_t minimk_socket_info_find(socket_info **pinfo, minimk_socket_t hand
     uint8_t type = handle_type(handle);
     MINIMK_TRACE_SOCKET("find_socketinfo type=0x%llx\n", CAST_ULL(type));
     MINIMK_TRACE_SOCKET("find_socketinfo generation=0x%llx\n", CAST_ULL(handle_generation(handle)));
-    uint64_t index = handle_index(handle);
+    uint32_t index = handle_index(handle);
     MINIMK_TRACE_SOCKET("find_socketinfo index=0x%llx\n", CAST_ULL(index));
 
     // Reject handles owned by other subsystems
@@ -52,6 +61,12 @@ minimk_error_t minimk_socket_info_find(socket_info **pinfo, minimk_socket_t hand
         return MINIMK_EBADF;
     }
 
+    // Reject indexes beyond the allocated table
+    if (index >= minimk_socket_info_capacity()) {
+        MINIMK_TRACE_SOCKET("find_socketinfo result=%s\n", minimk_errno_name(MINIMK_EBADF));
+        return MINIMK_EBADF;
+    }
+
     // Access the corresponding slot
     socket_info *info = minimk_socket_info_get(index);
     MINIMK_TRACE_SOCKET("find_socketinfo ptr=%p\n", CAST_VOID_P(info));
@@ -73,57 +88,40 @@ minimk_error_t minimk_socket_info_create(socket_info **pinfo, minimk_syscall_soc
     // Zero the return argument
     *pinfo = nullptr;
 
-    MINIMK_TRACE_SOCKET("create_socketinfo next_slot=%zu\n", next_slot);
-    MINIMK_TRACE_SOCKET("create_socketinfo generation=%llu\n", CAST_ULL(generation));
-
-    // We need to search at most MAX_SOCKETS times before giving up
-    for (size_t idx = 0; idx < MAX_SOCKETS && *pinfo == nullptr; idx++) {
-        // Use modulo to stay within the bounds
-        size_t slot_index = next_slot % MAX_SOCKETS;
-        socket_info *info = minimk_socket_info_get(slot_index);
-
-        MINIMK_TRACE_SOCKET("create_socketinfo iteration=%zu\n", idx);
-        MINIMK_TRACE_SOCKET("create_socketinfo candidate_index=%zu\n", slot_index);
-        MINIMK_TRACE_SOCKET("create_socketinfo next_slot=%zu\n", next_slot);
-        MINIMK_TRACE_SOCKET("create_socketinfo stored_handle=0x%llx\n", CAST_ULL(info->handle));
-
-        // A zero handle indicates that the slot is free
-        if (info->handle == 0) {
-            MINIMK_TRACE_SOCKET("create_socketinfo %s\n", "slot is free");
-
-            *pinfo = info;
-            MINIMK_ASSERT(slot_index <= UINT8_MAX);
-            info->handle = make_handle(HANDLE_TYPE_SOCKET, generation, static_cast<uint8_t>(slot_index));
-            info->fd = fd;
-            info->read_timeout = UINT64_MAX;
-            info->write_timeout = UINT64_MAX;
-
-            MINIMK_TRACE_SOCKET("create_socketinfo type=0x%llx\n", CAST_ULL(HANDLE_TYPE_SOCKET));
-            MINIMK_TRACE_SOCKET("create_socketinfo generation=0x%llx\n", CAST_ULL(generation));
-            MINIMK_TRACE_SOCKET("create_socketinfo index=0x%llx\n", CAST_ULL(slot_index));
-            MINIMK_TRACE_SOCKET("create_socketinfo handle=0x%llx\n", CAST_ULL(info->handle));
-            // FALLTHROUGH
-        }
-
-        // Increment the next slot to search
-        next_slot++;
-
-        // Check for a jump to the next generation
-        if (next_slot >= 2 && (next_slot % MAX_SOCKETS) == 0) {
-            MINIMK_TRACE_SOCKET("create_socketinfo %s", "generation++\n");
-            generation++;
-        }
+    // Pop the oldest free slot, growing the table by one chunk when all the
+    // slots are busy, where a zero handle marks a free slot
+    uint32_t slot_index = MINIMK_SLAB_TABLE_NONE;
+    minimk_error_t rv = minimk_slab_table_alloc(&table, &slot_index);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("create_socketinfo result=%s\n", minimk_errno_name(rv));
+        return rv;
     }
+    socket_info *info = minimk_socket_info_get(slot_index);
+    MINIMK_ASSERT(info->handle == 0);
+    MINIMK_TRACE_SOCKET("create_socketinfo capacity=%zu\n", minimk_socket_info_capacity());
+
+    // Initialize the entry
+    info->handle = make_handle(HANDLE_TYPE_SOCKET, info->generation, slot_index);
+    info->fd = fd;
+    info->read_timeout = UINT64_MAX;
+    info->write_timeout = UINT64_MAX;
+    info->flags = SOCKET_INFO_FLAG_READABLE | SOCKET_INFO_FLAG_WRITABLE;
+    *pinfo = info;
 
-    // Return the appropriate result
-    if (*pinfo == nullptr) {
-        MINIMK_TRACE_SOCKET("create_socketinfo result=%s\n", minimk_errno_name(MINIMK_EMFILE));
-        return MINIMK_EMFILE;
-    }
+    MINIMK_TRACE_SOCKET("create_socketinfo index=0x%llx\n", CAST_ULL(slot_index));
+    MINIMK_TRACE_SOCKET("create_socketinfo handle=0x%llx\n", CAST_ULL(info->handle));
     MINIMK_TRACE_SOCKET("create_socketinfo result=%s\n", minimk_errno_name(0));
     return 0;
 }
 
 void minimk_socket_info_forget(socket_info *info) noexcept {
+    // Clear the entry while preserving its generation
+    MINIMK_ASSERT(info->handle != 0);
+    uint32_t index = handle_index(info->handle);
+    uint32_t generation = info->generation + 1;
     *info = {};
+    info->generation = generation;
+
+    // Make the entry reusable only after all the other free entries
+    minimk_slab_table_free(&table, index);
 }
@@ -7,12 +7,22 @@
 #include "handle.hpp" // for MAX_HANDLES
 #include "minimk/cdefs.h"
 
-#include <minimk/errno.h>   // for minimk_error_t
-#include <minimk/socket.h>  // for minimk_socket_t
-#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/syscall.h>   // for minimk_syscall_*
 
 #include <stddef.h> // for size_t
-#include <stdint.h> // for UINT64_MAX
+#include <stdint.h> // for uint32_t, uint64_t
+
+/// Flag indicating that the socket may be readable without blocking.
+#define SOCKET_INFO_FLAG_READABLE (1 << 0)
+
+/// Flag indicating that the socket may be writable without blocking.
+#define SOCKET_INFO_FLAG_WRITABLE (1 << 1)
+
+/// Flag indicating that SO_ZEROCOPY is enabled, so MSG_ZEROCOPY sends are allowed.
+#define SOCKET_INFO_FLAG_ZEROCOPY (1 << 2)
 
 /// Maximum number of sockets managed by the runtime.
 #define MAX_SOCKETS MAX_HANDLES
@@ -21,6 +31,19 @@
 // assigned is different from `MAX_HANDLES`.
 static_assert(MAX_SOCKETS <= MAX_HANDLES, "MAX_SOCKETS must be <= MAX_HANDLES");
 
+/// Number of entries in each chunk of the sockets table.
+///
+/// The table grows one chunk at a time, so we only pay for the
+/// sockets we actually use, and never moves existing chunks, so
+/// pointers to entries remain valid across coroutine switches.
+#define SOCKET_INFO_CHUNK_SIZE 1024
+
+/// Maximum number of chunks in the sockets table.
+#define MAX_SOCKET_INFO_CHUNKS (MAX_SOCKETS / SOCKET_INFO_CHUNK_SIZE)
+
+// Ensure that the chunks exactly cover the sockets table.
+static_assert(MAX_SOCKETS % SOCKET_INFO_CHUNK_SIZE == 0, "MAX_SOCKETS must be a multiple of the chunk size");
+
 /// Socket slot in the runtime table.
 struct socket_info {
     /// The actual handle associated to this entry.
@@ -32,17 +55,45 @@ struct socket_info {
     /// Write timeout in nanoseconds.
     uint64_t write_timeout;
 
+    /// Limiter shaping send and sendto or NULL.
+    minimk_ratelimit_t *send_limit;
+
+    /// Limiter shaping recv or NULL.
+    minimk_ratelimit_t *recv_limit;
+
     /// The underlying OS socket file descriptor.
     minimk_syscall_socket_t fd;
 
-    /// Padding to align to 16 bytes.
-    uint32_t padding;
+    /// Readiness cache using the SOCKET_INFO_FLAG_* bits.
+    ///
+    /// A set bit means that the socket may be ready, so we should attempt
+    /// the corresponding I/O operation. A clear bit means that the socket
+    /// is known not to be ready (we saw EAGAIN or a short I/O), so we should
+    /// suspend before trying again. Bits are set again on wakeup.
+    uint32_t flags;
+
+    /// Generation of this slot, incremented each time the slot is forgotten.
+    uint32_t generation;
+
+    /// Index of the next free slot or MINIMK_SLAB_TABLE_NONE, valid only while the slot is free.
+    uint32_t next_free;
+
+    /// Notification ID that the kernel will assign to the next MSG_ZEROCOPY send.
+    uint32_t zc_next;
+
+    /// Number of MSG_ZEROCOPY sends whose completion we have reaped, in order.
+    uint32_t zc_completed;
 };
 
 MINIMK_BEGIN_DECLS
 
+/// Function returning the number of entries currently allocated in the sockets table.
+size_t minimk_socket_info_capacity(void) noexcept;
+
 /// Function for accessing a specific sockets table entry.
 ///
+/// The idx argument must be lower than minimk_socket_info_capacity().
+///
 /// The return value cannot be NULL. However, the entry may belong
 /// to a previous generation and could thus be invalid.
 socket_info *minimk_socket_info_get(size_t idx) noexcept;
@@ -62,11 +113,17 @@ minimk_error_t minimk_socket_info_find(socket_info **pinfo, minimk_socket_t hand
 ///
 /// The fd argument is the syscall socket descriptor for which to create a new entry.
 ///
+/// We take the oldest free entry from a FIFO free list, so a forgotten entry is
+/// reused only after all the other free entries. When all the allocated entries
+/// are in use, we grow the table by one chunk.
+///
 /// The return value is zero on success and a nonzero error code on failure.
 minimk_error_t minimk_socket_info_create(socket_info **pinfo, minimk_syscall_socket_t fd) noexcept;
 
 /// Function to clear a given entry and make it reusable in the future.
 ///
+/// We bump the entry generation, so existing handles referring to it become stale.
+///
 /// You must close the underlying socket before doing this.
 void minimk_socket_info_forget(socket_info *info) noexcept;
 
@@ -8,24 +8,29 @@
 
 #include "info.hpp" // for struct socket_info
 
-#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
-#include <minimk/errno.h>   // for minimk_error_t
-#include <minimk/runtime.h> // for minimk_runtime_suspend_*
-#include <minimk/socket.h>  // for minimk_socket_t
-#include <minimk/syscall.h> // for minimk_syscall_*
-#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_acquire, minimk_ratelimit_quantum
+#include <minimk/runtime.h>   // for minimk_runtime_suspend_*
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/syscall.h>   // for minimk_syscall_*
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
 
 #include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
 
 /// Testable minimk_socket_recv implementation.
 template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
           decltype(minimk_syscall_recv) M_recv = minimk_syscall_recv,
-          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read>
+          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read,
+          decltype(minimk_ratelimit_acquire) M_acquire = minimk_ratelimit_acquire>
 MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_recv_impl(minimk_socket_t sock, void *data, size_t count,
                                                             size_t *nread) noexcept {
     MINIMK_TRACE_SOCKET("recv handle=0x%llx\n", CAST_ULL(sock));
     MINIMK_TRACE_SOCKET("recv count=%zu\n", count);
 
+    *nread = 0;
+
     // Find the corresponding info
     socket_info *info = nullptr;
     minimk_error_t rv = M_info_find(&info, sock);
@@ -37,18 +42,43 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_recv_impl(minimk_socket_t sock
     MINIMK_TRACE_SOCKET("recv fd=%llu\n", CAST_ULL(info->fd));
     MINIMK_TRACE_SOCKET("recv read_timeout=%llu\n", CAST_ULL(info->read_timeout));
 
+    // Shape the throughput by transferring no more than the limiter allows, while
+    // waiting for at least a quantum of tokens to avoid tiny system calls
+    if (info->recv_limit != nullptr && count > 0) {
+        size_t granted = 0;
+        rv = M_acquire(info->recv_limit, count, minimk_ratelimit_quantum(info->recv_limit, count), &granted);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("recv result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        count = granted;
+    }
+
     for (;;) {
-        // Attempt to read data
-        *nread = 0;
-        rv = M_recv(info->fd, data, count, nread);
+        // Attempt to read data unless we know the socket is not readable
+        if ((info->flags & SOCKET_INFO_FLAG_READABLE) != 0) {
+            rv = M_recv(info->fd, data, count, nread);
 
-        MINIMK_TRACE_SOCKET("recv syscall_result=%s\n", minimk_errno_name(rv));
-        MINIMK_TRACE_SOCKET("recv nread=%zu\n", *nread);
+            MINIMK_TRACE_SOCKET("recv syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("recv nread=%zu\n", *nread);
 
-        // We only need to continue trying on EAGAIN
-        if (rv != MINIMK_EAGAIN) {
-            MINIMK_TRACE_SOCKET("recv result=%s\n", minimk_errno_name(rv));
-            return rv;
+            // A short read means we have drained the socket buffer
+            if (rv == 0 && *nread < count) {
+                info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
+            }
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                // Give back the tokens we did not use
+                if (info->recv_limit != nullptr) {
+                    minimk_ratelimit_refund(info->recv_limit, count - *nread);
+                }
+                MINIMK_TRACE_SOCKET("recv result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket is not readable
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
         }
 
         // Block until reading would not block
@@ -56,11 +86,15 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_recv_impl(minimk_socket_t sock
         MINIMK_TRACE_SOCKET("recv suspend_read timeout=%llu\n", CAST_ULL(info->read_timeout));
         rv = M_suspend_read(info->fd, info->read_timeout);
         if (rv != 0) {
+            if (info->recv_limit != nullptr) {
+                minimk_ratelimit_refund(info->recv_limit, count);
+            }
             MINIMK_TRACE_SOCKET("recv suspend_read result=%s\n", minimk_errno_name(rv));
             MINIMK_TRACE_SOCKET("recv result=%s\n", minimk_errno_name(rv));
             return rv;
         }
         MINIMK_TRACE_SOCKET("recv resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_READABLE;
     }
 }
 
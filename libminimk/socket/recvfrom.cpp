@@ -0,0 +1,16 @@
+// File: libminimk/socket/recvfrom.cpp
+// Purpose: recvfrom implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "recvfrom.hpp" // for minimk_socket_recvfrom_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_recvfrom(minimk_socket_t sock, void *data, size_t count, minimk_sockaddr_t *sa,
+                                      size_t *nread) noexcept {
+    return minimk_socket_recvfrom_impl(sock, data, count, sa, nread);
+}
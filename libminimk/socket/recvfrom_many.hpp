@@ -0,0 +1,82 @@
+// File: libminimk/socket/recvfrom_many.hpp
+// Purpose: recvfrom_many implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_RECVFROM_MANY_HPP
+#define LIBMINIMK_SOCKET_RECVFROM_MANY_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/datagram.h> // for minimk_datagram_t, MINIMK_DATAGRAM_BATCH_MAX
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/runtime.h>  // for minimk_runtime_suspend_*
+#include <minimk/socket.h>   // for minimk_socket_t
+#include <minimk/syscall.h>  // for minimk_syscall_*
+#include <minimk/trace.h>    // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_recvfrom_many implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_recvmmsg) M_recvmmsg = minimk_syscall_recvmmsg,
+          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_recvfrom_many_impl(minimk_socket_t sock,
+                                                                     minimk_datagram_t *dgrams, size_t count,
+                                                                     size_t *nrecv) noexcept {
+    MINIMK_TRACE_SOCKET("recvfrom_many handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("recvfrom_many count=%zu\n", count);
+
+    *nrecv = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("recvfrom_many result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("recvfrom_many fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("recvfrom_many read_timeout=%llu\n", CAST_ULL(info->read_timeout));
+
+    for (;;) {
+        // Attempt the I/O unless we know the socket would block
+        if ((info->flags & SOCKET_INFO_FLAG_READABLE) != 0) {
+            rv = M_recvmmsg(info->fd, dgrams, count, nrecv);
+
+            MINIMK_TRACE_SOCKET("recvfrom_many syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("recvfrom_many nrecv=%zu\n", *nrecv);
+
+            // Receiving fewer datagrams than requested means we have drained the socket buffer
+            if (rv == 0 && *nrecv < count && *nrecv < MINIMK_DATAGRAM_BATCH_MAX) {
+                info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
+            }
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                MINIMK_TRACE_SOCKET("recvfrom_many result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket would block
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
+        }
+
+        // Block until ready
+        MINIMK_TRACE_SOCKET("recvfrom_many suspend_read fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("recvfrom_many suspend_read timeout=%llu\n", CAST_ULL(info->read_timeout));
+        rv = M_suspend_read(info->fd, info->read_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("recvfrom_many suspend_read result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("recvfrom_many result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("recvfrom_many resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_READABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_RECVFROM_MANY_HPP
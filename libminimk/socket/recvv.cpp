@@ -0,0 +1,16 @@
+// File: libminimk/socket/recvv.cpp
+// Purpose: recvv implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "recvv.hpp" // for minimk_socket_recvv_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iovec.h>  // for minimk_iovec_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_recvv(minimk_socket_t sock, minimk_iovec_t *iov, size_t iovcnt,
+                                   size_t *nread) noexcept {
+    return minimk_socket_recvv_impl(sock, iov, iovcnt, nread);
+}
@@ -0,0 +1,85 @@
+// File: libminimk/socket/recvv.hpp
+// Purpose: recvv implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_RECVV_HPP
+#define LIBMINIMK_SOCKET_RECVV_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/iovec.h>   // for minimk_iovec_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_recvv implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_recvv) M_recvv = minimk_syscall_recvv,
+          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_recvv_impl(minimk_socket_t sock, minimk_iovec_t *iov,
+                                                             size_t iovcnt, size_t *nread) noexcept {
+    MINIMK_TRACE_SOCKET("recvv handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("recvv iovcnt=%zu\n", iovcnt);
+
+    // Compute the total size to detect short I/O
+    size_t count = minimk_iovec_total(iov, iovcnt);
+    MINIMK_TRACE_SOCKET("recvv count=%zu\n", count);
+
+    *nread = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("recvv result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("recvv fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("recvv read_timeout=%llu\n", CAST_ULL(info->read_timeout));
+
+    for (;;) {
+        // Attempt to read data unless we know the socket is not readable
+        if ((info->flags & SOCKET_INFO_FLAG_READABLE) != 0) {
+            rv = M_recvv(info->fd, iov, iovcnt, nread);
+
+            MINIMK_TRACE_SOCKET("recvv syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("recvv nread=%zu\n", *nread);
+
+            // A short read means we have drained the socket buffer
+            if (rv == 0 && *nread < count) {
+                info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
+            }
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                MINIMK_TRACE_SOCKET("recvv result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket is not readable
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_READABLE);
+        }
+
+        // Block until reading would not block
+        MINIMK_TRACE_SOCKET("recvv suspend_read fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("recvv suspend_read timeout=%llu\n", CAST_ULL(info->read_timeout));
+        rv = M_suspend_read(info->fd, info->read_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("recvv suspend_read result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("recvv result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("recvv resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_READABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_RECVV_HPP
@@ -8,24 +8,29 @@
 
 #include "info.hpp" // for struct socket_info
 
-#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
-#include <minimk/errno.h>   // for minimk_error_t
-#include <minimk/runtime.h> // for minimk_runtime_suspend_*
-#include <minimk/socket.h>  // for minimk_socket_t
-#include <minimk/syscall.h> // for minimk_syscall_*
-#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_acquire, minimk_ratelimit_quantum
+#include <minimk/runtime.h>   // for minimk_runtime_suspend_*
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/syscall.h>   // for minimk_syscall_*
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
 
 #include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
 
 /// Testable minimk_socket_send implementation.
 template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
           decltype(minimk_syscall_send) M_send = minimk_syscall_send,
-          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write>
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write,
+          decltype(minimk_ratelimit_acquire) M_acquire = minimk_ratelimit_acquire>
 MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_send_impl(minimk_socket_t sock, const void *data,
                                                             size_t count, size_t *nwritten) noexcept {
     MINIMK_TRACE_SOCKET("send handle=0x%llx\n", CAST_ULL(sock));
     MINIMK_TRACE_SOCKET("send count=%zu\n", count);
 
+    *nwritten = 0;
+
     // Find the corresponding info
     socket_info *info = nullptr;
     minimk_error_t rv = M_info_find(&info, sock);
@@ -37,18 +42,43 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_send_impl(minimk_socket_t sock
     MINIMK_TRACE_SOCKET("send fd=%llu\n", CAST_ULL(info->fd));
     MINIMK_TRACE_SOCKET("send write_timeout=%llu\n", CAST_ULL(info->write_timeout));
 
+    // Shape the throughput by transferring no more than the limiter allows, while
+    // waiting for at least a quantum of tokens to avoid tiny system calls
+    if (info->send_limit != nullptr && count > 0) {
+        size_t granted = 0;
+        rv = M_acquire(info->send_limit, count, minimk_ratelimit_quantum(info->send_limit, count), &granted);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("send result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        count = granted;
+    }
+
     for (;;) {
-        // Attempt to send data
-        *nwritten = 0;
-        rv = M_send(info->fd, data, count, nwritten);
+        // Attempt to send data unless we know the socket is not writable
+        if ((info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            rv = M_send(info->fd, data, count, nwritten);
 
-        MINIMK_TRACE_SOCKET("send syscall_result=%s\n", minimk_errno_name(rv));
-        MINIMK_TRACE_SOCKET("send nwritten=%zu\n", *nwritten);
+            MINIMK_TRACE_SOCKET("send syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("send nwritten=%zu\n", *nwritten);
 
-        // We only need to continue trying on EAGAIN
-        if (rv != MINIMK_EAGAIN) {
-            MINIMK_TRACE_SOCKET("send result=%s\n", minimk_errno_name(rv));
-            return rv;
+            // A short write means we have filled the socket buffer
+            if (rv == 0 && *nwritten < count) {
+                info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+            }
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                // Give back the tokens we did not use
+                if (info->send_limit != nullptr) {
+                    minimk_ratelimit_refund(info->send_limit, count - *nwritten);
+                }
+                MINIMK_TRACE_SOCKET("send result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket is not writable
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
         }
 
         // Block until ready
@@ -56,11 +86,15 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_send_impl(minimk_socket_t sock
         MINIMK_TRACE_SOCKET("send suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
         rv = M_suspend_write(info->fd, info->write_timeout);
         if (rv != 0) {
+            if (info->send_limit != nullptr) {
+                minimk_ratelimit_refund(info->send_limit, count);
+            }
             MINIMK_TRACE_SOCKET("send suspend_write result=%s\n", minimk_errno_name(rv));
             MINIMK_TRACE_SOCKET("send result=%s\n", minimk_errno_name(rv));
             return rv;
         }
         MINIMK_TRACE_SOCKET("send resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
     }
 }
 
@@ -0,0 +1,16 @@
+// File: libminimk/socket/send_zerocopy.cpp
+// Purpose: send_zerocopy implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "send_zerocopy.hpp" // for minimk_socket_send_zerocopy_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+minimk_error_t minimk_socket_send_zerocopy(minimk_socket_t sock, const void *data, size_t count,
+                                           size_t *nwritten, uint32_t *id) noexcept {
+    return minimk_socket_send_zerocopy_impl(sock, data, count, nwritten, id);
+}
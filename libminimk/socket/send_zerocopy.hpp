@@ -0,0 +1,93 @@
+// File: libminimk/socket/send_zerocopy.hpp
+// Purpose: send_zerocopy implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SEND_ZEROCOPY_HPP
+#define LIBMINIMK_SOCKET_SEND_ZEROCOPY_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_send_zerocopy implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_send_zerocopy) M_send_zerocopy = minimk_syscall_send_zerocopy,
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_send_zerocopy_impl( //
+        minimk_socket_t sock, const void *data, size_t count, size_t *nwritten, uint32_t *id) noexcept {
+    MINIMK_TRACE_SOCKET("send_zerocopy handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("send_zerocopy count=%zu\n", count);
+    *nwritten = 0;
+    *id = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("send_zerocopy result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    // Without SO_ZEROCOPY the kernel would copy and never post a completion
+    if ((info->flags & SOCKET_INFO_FLAG_ZEROCOPY) == 0) {
+        MINIMK_TRACE_SOCKET("send_zerocopy result=%s\n", minimk_errno_name(MINIMK_EINVAL));
+        return MINIMK_EINVAL;
+    }
+
+    MINIMK_TRACE_SOCKET("send_zerocopy fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("send_zerocopy write_timeout=%llu\n", CAST_ULL(info->write_timeout));
+
+    for (;;) {
+        // Attempt to send data unless we know the socket is not writable
+        if ((info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            *nwritten = 0;
+            rv = M_send_zerocopy(info->fd, data, count, nwritten);
+
+            MINIMK_TRACE_SOCKET("send_zerocopy syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("send_zerocopy nwritten=%zu\n", *nwritten);
+
+            // The kernel numbers successful sends sequentially, so we can predict the ID
+            if (rv == 0) {
+                *id = info->zc_next++;
+                MINIMK_TRACE_SOCKET("send_zerocopy id=%llu\n", CAST_ULL(*id));
+            }
+
+            // A short write means we have filled the socket buffer
+            if (rv == 0 && *nwritten < count) {
+                info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+            }
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                MINIMK_TRACE_SOCKET("send_zerocopy result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket is not writable
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+        }
+
+        // Block until ready
+        MINIMK_TRACE_SOCKET("send_zerocopy suspend_write fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("send_zerocopy suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_write(info->fd, info->write_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("send_zerocopy suspend_write result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("send_zerocopy result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("send_zerocopy resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_SEND_ZEROCOPY_HPP
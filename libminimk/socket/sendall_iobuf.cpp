@@ -0,0 +1,13 @@
+// File: libminimk/socket/sendall_iobuf.cpp
+// Purpose: sendall_iobuf implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendall_iobuf.hpp" // for minimk_socket_sendall_iobuf_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iobuf.h>  // for minimk_iobuf_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+minimk_error_t minimk_socket_sendall_iobuf(minimk_socket_t sock, minimk_iobuf_t *buf) noexcept {
+    return minimk_socket_sendall_iobuf_impl(sock, buf);
+}
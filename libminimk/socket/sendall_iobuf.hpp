@@ -0,0 +1,52 @@
+// File: libminimk/socket/sendall_iobuf.hpp
+// Purpose: sendall_iobuf implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SENDALL_IOBUF_HPP
+#define LIBMINIMK_SOCKET_SENDALL_IOBUF_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include <minimk/cdefs.h>  // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iobuf.h>  // for minimk_iobuf_t
+#include <minimk/iovec.h>  // for minimk_iovec_t
+#include <minimk/socket.h> // for minimk_socket_sendv
+#include <minimk/trace.h>  // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+
+/// Maximum number of segments we pass to a single sendv.
+#define SENDALL_IOBUF_MAX_IOV 32
+
+/// Testable minimk_socket_sendall_iobuf implementation.
+template <decltype(minimk_socket_sendv) M_sendv = minimk_socket_sendv>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_sendall_iobuf_impl(minimk_socket_t sock,
+                                                                     minimk_iobuf_t *buf) noexcept {
+    MINIMK_TRACE_SOCKET("sendall_iobuf handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("sendall_iobuf len=%zu\n", buf->len);
+    MINIMK_TRACE_SOCKET("sendall_iobuf nsegs=%zu\n", buf->nsegs);
+    while (buf->len > 0) {
+        // Gather the segments directly from the chain
+        minimk_iovec_t iov[SENDALL_IOBUF_MAX_IOV];
+        size_t iovcnt = minimk_iobuf_export(buf, iov, SENDALL_IOBUF_MAX_IOV);
+
+        size_t nwritten = 0;
+        minimk_error_t rv = M_sendv(sock, iov, iovcnt, &nwritten);
+
+        // Like minimk_socket_sendall, continue writing relentlessly when interrupted
+        if (rv == MINIMK_EINTR) {
+            continue;
+        }
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("sendall_iobuf result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+
+        // Release what the kernel has accepted, which never exceeds the chain length
+        (void)minimk_iobuf_drop(buf, nwritten);
+    }
+    MINIMK_TRACE_SOCKET("sendall_iobuf result=%s\n", minimk_errno_name(0));
+    return 0;
+}
+
+#endif // LIBMINIMK_SOCKET_SENDALL_IOBUF_HPP
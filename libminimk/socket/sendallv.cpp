@@ -0,0 +1,15 @@
+// File: libminimk/socket/sendallv.cpp
+// Purpose: sendallv implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendallv.hpp" // for minimk_socket_sendallv_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iovec.h>  // for minimk_iovec_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_sendallv(minimk_socket_t sock, minimk_iovec_t *iov, size_t iovcnt) noexcept {
+    return minimk_socket_sendallv_impl(sock, iov, iovcnt);
+}
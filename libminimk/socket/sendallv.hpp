@@ -0,0 +1,29 @@
+// File: libminimk/socket/sendallv.hpp
+// Purpose: sendallv implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SENDALLV_HPP
+#define LIBMINIMK_SOCKET_SENDALLV_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include <minimk/cdefs.h>  // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iovec.h>  // for minimk_iovec_t
+#include <minimk/io.hpp>   // for minimk_io_writeallv
+#include <minimk/socket.h> // for minimk_socket_t
+#include <minimk/trace.h>  // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_socket_sendallv implementation.
+template <decltype(minimk_socket_sendv) M_sendv = minimk_socket_sendv>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_sendallv_impl(minimk_socket_t sock, minimk_iovec_t *iov,
+                                                                size_t iovcnt) noexcept {
+    MINIMK_TRACE_SOCKET("sendallv handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("sendallv iovcnt=%zu\n", iovcnt);
+    minimk_error_t rv = minimk_io_writeallv<minimk_socket_t, M_sendv>(sock, iov, iovcnt);
+    MINIMK_TRACE_SOCKET("sendallv result=%s\n", minimk_errno_name(rv));
+    return rv;
+}
+
+#endif // LIBMINIMK_SOCKET_SENDALLV_HPP
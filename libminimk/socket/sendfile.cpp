@@ -0,0 +1,17 @@
+// File: libminimk/socket/sendfile.cpp
+// Purpose: sendfile implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendfile.hpp" // for minimk_socket_sendfile_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_socket_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+minimk_error_t minimk_socket_sendfile(minimk_socket_t sock, minimk_syscall_socket_t fd, uint64_t offset,
+                                      size_t count, size_t *nwritten) noexcept {
+    return minimk_socket_sendfile_impl(sock, fd, offset, count, nwritten);
+}
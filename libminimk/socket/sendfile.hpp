@@ -0,0 +1,79 @@
+// File: libminimk/socket/sendfile.hpp
+// Purpose: sendfile implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SENDFILE_HPP
+#define LIBMINIMK_SOCKET_SENDFILE_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t, uint64_t
+
+/// Testable minimk_socket_sendfile implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_sendfile) M_sendfile = minimk_syscall_sendfile,
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_sendfile_impl( //
+        minimk_socket_t sock, minimk_syscall_socket_t fd, uint64_t offset, size_t count,
+        size_t *nwritten) noexcept {
+    MINIMK_TRACE_SOCKET("sendfile handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("sendfile in_fd=%llu\n", CAST_ULL(fd));
+    MINIMK_TRACE_SOCKET("sendfile offset=%llu\n", CAST_ULL(offset));
+    MINIMK_TRACE_SOCKET("sendfile count=%zu\n", count);
+    *nwritten = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("sendfile result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("sendfile fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("sendfile write_timeout=%llu\n", CAST_ULL(info->write_timeout));
+
+    for (;;) {
+        // Attempt to send data unless we know the socket is not writable
+        if ((info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            *nwritten = 0;
+            rv = M_sendfile(info->fd, fd, offset, count, nwritten);
+
+            MINIMK_TRACE_SOCKET("sendfile syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendfile nwritten=%zu\n", *nwritten);
+
+            // We only need to continue trying on EAGAIN. Note that, unlike send, a short
+            // write does not imply the socket is full, since we may have hit end of file.
+            if (rv != MINIMK_EAGAIN) {
+                MINIMK_TRACE_SOCKET("sendfile result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket is not writable
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+        }
+
+        // Block until ready
+        MINIMK_TRACE_SOCKET("sendfile suspend_write fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("sendfile suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_write(info->fd, info->write_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("sendfile suspend_write result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendfile result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("sendfile resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_SENDFILE_HPP
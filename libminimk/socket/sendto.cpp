@@ -0,0 +1,16 @@
+// File: libminimk/socket/sendto.cpp
+// Purpose: sendto implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendto.hpp" // for minimk_socket_sendto_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_sendto(minimk_socket_t sock, const void *data, size_t count,
+                                    const minimk_sockaddr_t *sa, size_t *nwritten) noexcept {
+    return minimk_socket_sendto_impl(sock, data, count, sa, nwritten);
+}
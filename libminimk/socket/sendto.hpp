@@ -0,0 +1,97 @@
+// File: libminimk/socket/sendto.hpp
+// Purpose: sendto implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SENDTO_HPP
+#define LIBMINIMK_SOCKET_SENDTO_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_acquire
+#include <minimk/runtime.h>   // for minimk_runtime_suspend_*
+#include <minimk/sockaddr.h>  // for minimk_sockaddr_t
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/syscall.h>   // for minimk_syscall_*
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_sendto implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_sendto) M_sendto = minimk_syscall_sendto,
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write,
+          decltype(minimk_ratelimit_acquire) M_acquire = minimk_ratelimit_acquire>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_sendto_impl(minimk_socket_t sock, const void *data,
+                                                              size_t count, const minimk_sockaddr_t *sa,
+                                                              size_t *nwritten) noexcept {
+    MINIMK_TRACE_SOCKET("sendto handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("sendto count=%zu\n", count);
+
+    *nwritten = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("sendto result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("sendto fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("sendto write_timeout=%llu\n", CAST_ULL(info->write_timeout));
+
+    // Shape the throughput by transferring no more than the limiter allows
+    if (info->send_limit != nullptr && count > 0) {
+        size_t granted = 0;
+        rv = M_acquire(info->send_limit, count, count, &granted);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("sendto result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        count = granted;
+    }
+
+    for (;;) {
+        // Attempt the I/O unless we know the socket would block
+        if ((info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            rv = M_sendto(info->fd, data, count, sa, nwritten);
+
+            MINIMK_TRACE_SOCKET("sendto syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendto nwritten=%zu\n", *nwritten);
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                // Give back the tokens we did not use
+                if (info->send_limit != nullptr) {
+                    minimk_ratelimit_refund(info->send_limit, count - *nwritten);
+                }
+                MINIMK_TRACE_SOCKET("sendto result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket would block
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+        }
+
+        // Block until ready
+        MINIMK_TRACE_SOCKET("sendto suspend_write fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("sendto suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_write(info->fd, info->write_timeout);
+        if (rv != 0) {
+            if (info->send_limit != nullptr) {
+                minimk_ratelimit_refund(info->send_limit, count);
+            }
+            MINIMK_TRACE_SOCKET("sendto suspend_write result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendto result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("sendto resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_SENDTO_HPP
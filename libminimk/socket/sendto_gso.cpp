@@ -0,0 +1,17 @@
+// File: libminimk/socket/sendto_gso.cpp
+// Purpose: sendto_gso implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendto_gso.hpp" // for minimk_socket_sendto_gso_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_sendto_gso(minimk_socket_t sock, const void *data, size_t count,
+                                        const minimk_sockaddr_t *sa, size_t segment_size,
+                                        size_t *nwritten) noexcept {
+    return minimk_socket_sendto_gso_impl(sock, data, count, sa, segment_size, nwritten);
+}
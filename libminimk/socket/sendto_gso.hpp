@@ -0,0 +1,78 @@
+// File: libminimk/socket/sendto_gso.hpp
+// Purpose: sendto_gso implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SENDTO_GSO_HPP
+#define LIBMINIMK_SOCKET_SENDTO_GSO_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/runtime.h>  // for minimk_runtime_suspend_*
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/socket.h>   // for minimk_socket_t
+#include <minimk/syscall.h>  // for minimk_syscall_*
+#include <minimk/trace.h>    // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_sendto_gso implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_sendto_gso) M_sendto_gso = minimk_syscall_sendto_gso,
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_sendto_gso_impl(minimk_socket_t sock, const void *data,
+                                                                  size_t count, const minimk_sockaddr_t *sa,
+                                                                  size_t segment_size,
+                                                                  size_t *nwritten) noexcept {
+    MINIMK_TRACE_SOCKET("sendto_gso handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("sendto_gso count=%zu\n", count);
+
+    *nwritten = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("sendto_gso result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("sendto_gso fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("sendto_gso write_timeout=%llu\n", CAST_ULL(info->write_timeout));
+
+    for (;;) {
+        // Attempt the I/O unless we know the socket would block
+        if ((info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            rv = M_sendto_gso(info->fd, data, count, sa, segment_size, nwritten);
+
+            MINIMK_TRACE_SOCKET("sendto_gso syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendto_gso nwritten=%zu\n", *nwritten);
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                MINIMK_TRACE_SOCKET("sendto_gso result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket would block
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+        }
+
+        // Block until ready
+        MINIMK_TRACE_SOCKET("sendto_gso suspend_write fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("sendto_gso suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_write(info->fd, info->write_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("sendto_gso suspend_write result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendto_gso result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("sendto_gso resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_SENDTO_GSO_HPP
@@ -0,0 +1,16 @@
+// File: libminimk/socket/sendto_many.cpp
+// Purpose: sendto_many implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendto_many.hpp" // for minimk_socket_sendto_many_impl
+
+#include <minimk/datagram.h> // for minimk_datagram_t
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/socket.h>   // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_sendto_many(minimk_socket_t sock, minimk_datagram_t *dgrams, size_t count,
+                                         size_t *nsent) noexcept {
+    return minimk_socket_sendto_many_impl(sock, dgrams, count, nsent);
+}
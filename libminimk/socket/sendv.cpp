@@ -0,0 +1,16 @@
+// File: libminimk/socket/sendv.cpp
+// Purpose: sendv implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendv.hpp" // for minimk_socket_sendv_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/iovec.h>  // for minimk_iovec_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_sendv(minimk_socket_t sock, const minimk_iovec_t *iov, size_t iovcnt,
+                                   size_t *nwritten) noexcept {
+    return minimk_socket_sendv_impl(sock, iov, iovcnt, nwritten);
+}
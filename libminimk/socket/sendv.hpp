@@ -0,0 +1,85 @@
+// File: libminimk/socket/sendv.hpp
+// Purpose: sendv implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SENDV_HPP
+#define LIBMINIMK_SOCKET_SENDV_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/iovec.h>   // for minimk_iovec_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_sendv implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_sendv) M_sendv = minimk_syscall_sendv,
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_sendv_impl(minimk_socket_t sock, const minimk_iovec_t *iov,
+                                                             size_t iovcnt, size_t *nwritten) noexcept {
+    MINIMK_TRACE_SOCKET("sendv handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("sendv iovcnt=%zu\n", iovcnt);
+
+    // Compute the total size to detect short I/O
+    size_t count = minimk_iovec_total(iov, iovcnt);
+    MINIMK_TRACE_SOCKET("sendv count=%zu\n", count);
+
+    *nwritten = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("sendv result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("sendv fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("sendv write_timeout=%llu\n", CAST_ULL(info->write_timeout));
+
+    for (;;) {
+        // Attempt to send data unless we know the socket is not writable
+        if ((info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            rv = M_sendv(info->fd, iov, iovcnt, nwritten);
+
+            MINIMK_TRACE_SOCKET("sendv syscall_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendv nwritten=%zu\n", *nwritten);
+
+            // A short write means we have filled the socket buffer
+            if (rv == 0 && *nwritten < count) {
+                info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+            }
+
+            // We only need to continue trying on EAGAIN
+            if (rv != MINIMK_EAGAIN) {
+                MINIMK_TRACE_SOCKET("sendv result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            // Remember that the socket is not writable
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+        }
+
+        // Block until ready
+        MINIMK_TRACE_SOCKET("sendv suspend_write fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("sendv suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_write(info->fd, info->write_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("sendv suspend_write result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("sendv result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("sendv resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_SENDV_HPP
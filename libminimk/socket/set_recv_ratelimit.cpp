@@ -0,0 +1,13 @@
+// File: libminimk/socket/set_recv_ratelimit.cpp
+// Purpose: set_recv_ratelimit implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "set_recv_ratelimit.hpp" // for minimk_socket_set_recv_ratelimit_impl
+
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/socket.h>    // for minimk_socket_t
+
+minimk_error_t minimk_socket_set_recv_ratelimit(minimk_socket_t sock, minimk_ratelimit_t *limit) noexcept {
+    return minimk_socket_set_recv_ratelimit_impl(sock, limit);
+}
@@ -0,0 +1,36 @@
+// File: libminimk/socket/set_send_ratelimit.hpp
+// Purpose: set_send_ratelimit implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SET_SEND_RATELIMIT_HPP
+#define LIBMINIMK_SOCKET_SET_SEND_RATELIMIT_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL, CAST_VOID_P
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/ratelimit.h> // for minimk_ratelimit_t
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/trace.h>     // for MINIMK_TRACE_SOCKET
+
+/// Testable minimk_socket_set_send_ratelimit implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_socket_set_send_ratelimit_impl(minimk_socket_t sock, minimk_ratelimit_t *limit) noexcept {
+    MINIMK_TRACE_SOCKET("set_send_ratelimit handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("set_send_ratelimit limit=%p\n", CAST_VOID_P(limit));
+
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("set_send_ratelimit result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    info->send_limit = limit;
+    MINIMK_TRACE_SOCKET("set_send_ratelimit result=%s\n", minimk_errno_name(0));
+    return 0;
+}
+
+#endif // LIBMINIMK_SOCKET_SET_SEND_RATELIMIT_HPP
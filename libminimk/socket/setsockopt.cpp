@@ -0,0 +1,16 @@
+// File: libminimk/socket/setsockopt.cpp
+// Purpose: setsockopt implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt.hpp" // for minimk_socket_setsockopt_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/sockopt.h> // for minimk_sockopt_t
+
+#include <stdint.h> // for uint64_t
+
+minimk_error_t minimk_socket_setsockopt(minimk_socket_t sock, minimk_sockopt_t option,
+                                        uint64_t value) noexcept {
+    return minimk_socket_setsockopt_impl(sock, option, value);
+}
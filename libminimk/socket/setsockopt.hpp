@@ -0,0 +1,43 @@
+// File: libminimk/socket/setsockopt.hpp
+// Purpose: setsockopt implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SETSOCKOPT_HPP
+#define LIBMINIMK_SOCKET_SETSOCKOPT_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/sockopt.h> // for minimk_sockopt_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stdint.h> // for uint64_t
+
+/// Testable minimk_socket_setsockopt implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_setsockopt) M_setsockopt = minimk_syscall_setsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_setsockopt_impl( //
+        minimk_socket_t sock, minimk_sockopt_t option, uint64_t value) noexcept {
+    MINIMK_TRACE_SOCKET("setsockopt handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("setsockopt option=%d\n", option);
+    MINIMK_TRACE_SOCKET("setsockopt value=%llu\n", CAST_ULL(value));
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("setsockopt result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    // Set the option on the underlying socket
+    rv = M_setsockopt(info->fd, option, value);
+    MINIMK_TRACE_SOCKET("setsockopt result=%s\n", minimk_errno_name(rv));
+    return rv;
+}
+
+#endif // LIBMINIMK_SOCKET_SETSOCKOPT_HPP
@@ -0,0 +1,12 @@
+// File: libminimk/socket/setsockopt_congestion.cpp
+// Purpose: setsockopt_congestion implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_congestion.hpp" // for minimk_socket_setsockopt_congestion_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+minimk_error_t minimk_socket_setsockopt_congestion(minimk_socket_t sock, const char *algorithm) noexcept {
+    return minimk_socket_setsockopt_congestion_impl(sock, algorithm);
+}
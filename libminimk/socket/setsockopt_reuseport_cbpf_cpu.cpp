@@ -0,0 +1,12 @@
+// File: libminimk/socket/setsockopt_reuseport_cbpf_cpu.cpp
+// Purpose: setsockopt_reuseport_cbpf_cpu implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_reuseport_cbpf_cpu.hpp" // for minimk_socket_setsockopt_reuseport_cbpf_cpu_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+minimk_error_t minimk_socket_setsockopt_reuseport_cbpf_cpu(minimk_socket_t sock) noexcept {
+    return minimk_socket_setsockopt_reuseport_cbpf_cpu_impl(sock);
+}
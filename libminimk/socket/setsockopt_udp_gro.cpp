@@ -0,0 +1,12 @@
+// File: libminimk/socket/setsockopt_udp_gro.cpp
+// Purpose: setsockopt_udp_gro implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_udp_gro.hpp" // for minimk_socket_setsockopt_udp_gro_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+minimk_error_t minimk_socket_setsockopt_udp_gro(minimk_socket_t sock) noexcept {
+    return minimk_socket_setsockopt_udp_gro_impl(sock);
+}
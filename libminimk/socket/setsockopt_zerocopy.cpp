@@ -0,0 +1,12 @@
+// File: libminimk/socket/setsockopt_zerocopy.cpp
+// Purpose: setsockopt_zerocopy implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_zerocopy.hpp" // for minimk_socket_setsockopt_zerocopy_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+minimk_error_t minimk_socket_setsockopt_zerocopy(minimk_socket_t sock) noexcept {
+    return minimk_socket_setsockopt_zerocopy_impl(sock);
+}
@@ -0,0 +1,41 @@
+// File: libminimk/socket/setsockopt_zerocopy.hpp
+// Purpose: setsockopt_zerocopy implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SETSOCKOPT_ZEROCOPY_HPP
+#define LIBMINIMK_SOCKET_SETSOCKOPT_ZEROCOPY_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+/// Testable minimk_socket_setsockopt_zerocopy implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_setsockopt_zerocopy) M_setsockopt_zerocopy =
+                  minimk_syscall_setsockopt_zerocopy>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_setsockopt_zerocopy_impl(minimk_socket_t sock) noexcept {
+    MINIMK_TRACE_SOCKET("setsockopt_zerocopy handle=0x%llx\n", CAST_ULL(sock));
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("setsockopt_zerocopy result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    // Set SO_ZEROCOPY on the underlying socket and remember we did it
+    rv = M_setsockopt_zerocopy(info->fd);
+    if (rv == 0) {
+        info->flags |= SOCKET_INFO_FLAG_ZEROCOPY;
+    }
+    MINIMK_TRACE_SOCKET("setsockopt_zerocopy result=%s\n", minimk_errno_name(rv));
+    return rv;
+}
+
+#endif // LIBMINIMK_SOCKET_SETSOCKOPT_ZEROCOPY_HPP
@@ -0,0 +1,16 @@
+// File: libminimk/socket/splice.cpp
+// Purpose: splice implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "splice.hpp" // for minimk_socket_splice_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_socket_t
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_socket_splice(minimk_socket_t sock, minimk_syscall_socket_t pipefd, size_t count,
+                                    size_t *nwritten) noexcept {
+    return minimk_socket_splice_impl(sock, pipefd, count, nwritten);
+}
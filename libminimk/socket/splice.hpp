@@ -0,0 +1,98 @@
+// File: libminimk/socket/splice.hpp
+// Purpose: splice implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_SPLICE_HPP
+#define LIBMINIMK_SOCKET_SPLICE_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t
+
+/// Testable minimk_socket_splice implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_splice) M_splice = minimk_syscall_splice,
+          decltype(minimk_runtime_suspend_read) M_suspend_read = minimk_runtime_suspend_read,
+          decltype(minimk_runtime_suspend_write) M_suspend_write = minimk_runtime_suspend_write>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_splice_impl( //
+        minimk_socket_t sock, minimk_syscall_socket_t pipefd, size_t count, size_t *nwritten) noexcept {
+    MINIMK_TRACE_SOCKET("splice handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("splice pipefd=%llu\n", CAST_ULL(pipefd));
+    MINIMK_TRACE_SOCKET("splice count=%zu\n", count);
+    *nwritten = 0;
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("splice result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    MINIMK_TRACE_SOCKET("splice fd=%llu\n", CAST_ULL(info->fd));
+    MINIMK_TRACE_SOCKET("splice read_timeout=%llu\n", CAST_ULL(info->read_timeout));
+    MINIMK_TRACE_SOCKET("splice write_timeout=%llu\n", CAST_ULL(info->write_timeout));
+
+    // Since EAGAIN does not tell us which side would block, we assume the pipe is empty
+    // when the socket may be writable and the socket is full otherwise. Only this
+    // coroutine should read from the pipe, so, after we wait for the pipe to become
+    // readable, another EAGAIN necessarily means that the socket write would block.
+    bool pipe_readable = false;
+    for (;;) {
+        *nwritten = 0;
+        rv = M_splice(pipefd, info->fd, count, nwritten);
+
+        MINIMK_TRACE_SOCKET("splice syscall_result=%s\n", minimk_errno_name(rv));
+        MINIMK_TRACE_SOCKET("splice nwritten=%zu\n", *nwritten);
+
+        // We only need to continue trying on EAGAIN
+        if (rv != MINIMK_EAGAIN) {
+            MINIMK_TRACE_SOCKET("splice result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+
+        // Block until the pipe is readable
+        if (!pipe_readable && (info->flags & SOCKET_INFO_FLAG_WRITABLE) != 0) {
+            MINIMK_TRACE_SOCKET("splice suspend_read fd=%llu\n", CAST_ULL(pipefd));
+            MINIMK_TRACE_SOCKET("splice suspend_read timeout=%llu\n", CAST_ULL(info->read_timeout));
+            rv = M_suspend_read(pipefd, info->read_timeout);
+            if (rv != 0) {
+                MINIMK_TRACE_SOCKET("splice suspend_read result=%s\n", minimk_errno_name(rv));
+                MINIMK_TRACE_SOCKET("splice result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+            MINIMK_TRACE_SOCKET("splice resumed fd=%llu\n", CAST_ULL(pipefd));
+
+            // From now on, EAGAIN means the socket is not writable
+            pipe_readable = true;
+            continue;
+        }
+
+        // Remember that the socket is not writable, which we only know for sure
+        // once the pipe is readable, and block until it is
+        if (pipe_readable) {
+            info->flags &= ~static_cast<uint32_t>(SOCKET_INFO_FLAG_WRITABLE);
+        }
+        MINIMK_TRACE_SOCKET("splice suspend_write fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("splice suspend_write timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_write(info->fd, info->write_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("splice suspend_write result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("splice result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("splice resumed fd=%llu\n", CAST_ULL(info->fd));
+        info->flags |= SOCKET_INFO_FLAG_WRITABLE;
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_SPLICE_HPP
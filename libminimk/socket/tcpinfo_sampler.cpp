@@ -0,0 +1,11 @@
+// File: libminimk/socket/tcpinfo_sampler.cpp
+// Purpose: tcpinfo_sampler implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "tcpinfo_sampler.hpp" // for minimk_socket_tcpinfo_sampler_run_impl
+
+#include <minimk/socket.h> // for minimk_socket_tcpinfo_sampler_t
+
+void minimk_socket_tcpinfo_sampler_run(void *opaque) noexcept {
+    minimk_socket_tcpinfo_sampler_run_impl(static_cast<minimk_socket_tcpinfo_sampler_t *>(opaque));
+}
@@ -0,0 +1,62 @@
+// File: libminimk/socket/tcpinfo_sampler.hpp
+// Purpose: tcpinfo_sampler implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_TCPINFO_SAMPLER_HPP
+#define LIBMINIMK_SOCKET_TCPINFO_SAMPLER_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/runtime.h> // for minimk_runtime_nanosleep
+#include <minimk/socket.h>  // for minimk_socket_tcpinfo_sampler_t
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_ring_push
+#include <minimk/time.h>    // for minimk_time_monotonic_now
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+/// Testable minimk_socket_tcpinfo_sampler_run implementation.
+template <decltype(minimk_socket_get_tcpinfo) M_get_tcpinfo = minimk_socket_get_tcpinfo,
+          decltype(minimk_tcpinfo_ring_push) M_push = minimk_tcpinfo_ring_push,
+          decltype(minimk_time_monotonic_now) M_now = minimk_time_monotonic_now,
+          decltype(minimk_runtime_nanosleep) M_nanosleep = minimk_runtime_nanosleep>
+MINIMK_ALWAYS_INLINE void
+minimk_socket_tcpinfo_sampler_run_impl(minimk_socket_tcpinfo_sampler_t *sampler) noexcept {
+    MINIMK_TRACE_SOCKET("tcpinfo_sampler count=%zu\n", sampler->count);
+    MINIMK_TRACE_SOCKET("tcpinfo_sampler interval=%llu\n", CAST_ULL(sampler->interval));
+
+    // Follow a fixed schedule so that slow ticks do not accumulate drift
+    uint64_t next = M_now();
+    while (sampler->stop == 0) {
+        // Sample all the sockets that are still valid into their rings
+        size_t valid = 0;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        for (size_t idx = 0; idx < sampler->count; idx++) {
+            minimk_tcpinfo_t sample;
+            if (M_get_tcpinfo(sampler->socks[idx], &sample) == 0) {
+                M_push(&sampler->rings[idx], &sample);
+                valid++;
+            }
+        }
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+
+        // Stop when nothing is left to sample
+        MINIMK_TRACE_SOCKET("tcpinfo_sampler valid=%zu\n", valid);
+        if (valid <= 0) {
+            break;
+        }
+
+        // Sleep until the next tick, skipping the ticks we have missed
+        uint64_t now = M_now();
+        next += sampler->interval;
+        if (next <= now) {
+            next = now + sampler->interval;
+        }
+        M_nanosleep(next - now);
+    }
+
+    MINIMK_TRACE_SOCKET("tcpinfo_sampler %s\n", "done");
+}
+
+#endif // LIBMINIMK_SOCKET_TCPINFO_SAMPLER_HPP
@@ -0,0 +1,14 @@
+// File: libminimk/socket/zerocopy_wait.cpp
+// Purpose: zerocopy_wait implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "zerocopy_wait.hpp" // for minimk_socket_zerocopy_wait_impl
+
+#include <minimk/errno.h>  // for minimk_error_t
+#include <minimk/socket.h> // for minimk_socket_t
+
+#include <stdint.h> // for uint32_t
+
+minimk_error_t minimk_socket_zerocopy_wait(minimk_socket_t sock, uint32_t id) noexcept {
+    return minimk_socket_zerocopy_wait_impl(sock, id);
+}
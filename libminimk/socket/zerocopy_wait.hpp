@@ -0,0 +1,124 @@
+// File: libminimk/socket/zerocopy_wait.hpp
+// Purpose: zerocopy_wait implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SOCKET_ZEROCOPY_WAIT_HPP
+#define LIBMINIMK_SOCKET_ZEROCOPY_WAIT_HPP
+
+#include "../cast/static.hpp" // for CAST_ULL
+
+#include "info.hpp" // for struct socket_info
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/runtime.h> // for minimk_runtime_suspend_*
+#include <minimk/socket.h>  // for minimk_socket_t
+#include <minimk/syscall.h> // for minimk_syscall_*
+#include <minimk/trace.h>   // for MINIMK_TRACE_SOCKET
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for int32_t, uint32_t
+
+/// Returns whether the completion with the given ID has already been reaped.
+///
+/// We compare using serial number arithmetic since IDs wrap around.
+static inline bool minimk_socket_zerocopy_done(socket_info *info, uint32_t id) noexcept {
+    return static_cast<int32_t>(info->zc_completed - id) > 0;
+}
+
+/// Testable minimk_socket_zerocopy_wait implementation.
+template <decltype(minimk_socket_info_find) M_info_find = minimk_socket_info_find,
+          decltype(minimk_syscall_zerocopy_reap) M_reap = minimk_syscall_zerocopy_reap,
+          decltype(minimk_runtime_suspend_error) M_suspend_error = minimk_runtime_suspend_error,
+          decltype(minimk_syscall_getsockopt_error) M_getsockopt_error = minimk_syscall_getsockopt_error,
+          decltype(minimk_syscall_poll) M_poll = minimk_syscall_poll>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_socket_zerocopy_wait_impl( //
+        minimk_socket_t sock, uint32_t id) noexcept {
+    MINIMK_TRACE_SOCKET("zerocopy_wait handle=0x%llx\n", CAST_ULL(sock));
+    MINIMK_TRACE_SOCKET("zerocopy_wait id=%llu\n", CAST_ULL(id));
+
+    // Find the corresponding info
+    socket_info *info = nullptr;
+    minimk_error_t rv = M_info_find(&info, sock);
+    if (rv != 0) {
+        MINIMK_TRACE_SOCKET("zerocopy_wait result=%s\n", minimk_errno_name(rv));
+        return rv;
+    }
+
+    for (bool resumed = false;; resumed = true) {
+        // Drain the error queue, since completions are posted there
+        uint32_t before = info->zc_completed;
+        for (;;) {
+            uint32_t lo = 0, hi = 0;
+            rv = M_reap(info->fd, &lo, &hi);
+            MINIMK_TRACE_SOCKET("zerocopy_wait reap_result=%s\n", minimk_errno_name(rv));
+
+            // Skip messages that are not zero-copy completions
+            if (rv == MINIMK_EINVAL) {
+                continue;
+            }
+            if (rv != 0) {
+                break;
+            }
+
+            // TCP completes sends in order, so the range extends what we have seen
+            MINIMK_TRACE_SOCKET("zerocopy_wait lo=%llu\n", CAST_ULL(lo));
+            MINIMK_TRACE_SOCKET("zerocopy_wait hi=%llu\n", CAST_ULL(hi));
+            if (static_cast<int32_t>(hi + 1 - info->zc_completed) > 0) {
+                info->zc_completed = hi + 1;
+            }
+        }
+        if (rv != MINIMK_EAGAIN) {
+            MINIMK_TRACE_SOCKET("zerocopy_wait result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+
+        // Stop as soon as the buffer passed to the given send is reusable
+        if (minimk_socket_zerocopy_done(info, id)) {
+            MINIMK_TRACE_SOCKET("zerocopy_wait result=%s\n", minimk_errno_name(0));
+            return 0;
+        }
+
+        // POLLERR and POLLHUP also wake us up when there is nothing to reap, in which
+        // case sleeping again would spin, so we return if no completion can arrive
+        if (resumed && info->zc_completed == before) {
+            minimk_error_t sockerr = 0;
+            rv = M_getsockopt_error(info->fd, &sockerr);
+            MINIMK_TRACE_SOCKET("zerocopy_wait getsockopt_error_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("zerocopy_wait sockerr=%s\n", minimk_errno_name(sockerr));
+            if (rv == 0 && sockerr != 0) {
+                rv = sockerr;
+            }
+            if (rv != 0) {
+                MINIMK_TRACE_SOCKET("zerocopy_wait result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+
+            minimk_syscall_pollfd_t pfd = {};
+            pfd.fd = info->fd;
+            size_t nready = 0;
+            rv = M_poll(&pfd, 1, 0, &nready);
+            MINIMK_TRACE_SOCKET("zerocopy_wait poll_result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("zerocopy_wait revents=%llu\n", CAST_ULL(pfd.revents));
+            if (rv == 0 && (pfd.revents & minimk_syscall_pollhup) != 0) {
+                rv = MINIMK_ECONNRESET;
+            }
+            if (rv != 0) {
+                MINIMK_TRACE_SOCKET("zerocopy_wait result=%s\n", minimk_errno_name(rv));
+                return rv;
+            }
+        }
+
+        // Block until the kernel posts more completions
+        MINIMK_TRACE_SOCKET("zerocopy_wait suspend_error fd=%llu\n", CAST_ULL(info->fd));
+        MINIMK_TRACE_SOCKET("zerocopy_wait suspend_error timeout=%llu\n", CAST_ULL(info->write_timeout));
+        rv = M_suspend_error(info->fd, info->write_timeout);
+        if (rv != 0) {
+            MINIMK_TRACE_SOCKET("zerocopy_wait suspend_error result=%s\n", minimk_errno_name(rv));
+            MINIMK_TRACE_SOCKET("zerocopy_wait result=%s\n", minimk_errno_name(rv));
+            return rv;
+        }
+        MINIMK_TRACE_SOCKET("zerocopy_wait resumed fd=%llu\n", CAST_ULL(info->fd));
+    }
+}
+
+#endif // LIBMINIMK_SOCKET_ZEROCOPY_WAIT_HPP
@@ -0,0 +1,13 @@
+// File: libminimk/syscall/accept_nonblock_posix.cpp
+// Purpose: POSIX accept(2) wrapper returning nonblocking sockets
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "accept_nonblock_posix.hpp" // for minimk_syscall_accept_nonblock_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_accept_nonblock
+
+minimk_error_t minimk_syscall_accept_nonblock(minimk_syscall_socket_t *client_sock,
+                                              minimk_syscall_socket_t sock) noexcept {
+    return minimk_syscall_accept_nonblock_impl(client_sock, sock);
+}
@@ -0,0 +1,74 @@
+// File: libminimk/syscall/accept_nonblock_posix.hpp
+// Purpose: accept4(2) on Linux with fallback to accept(2) and fcntl(2) on POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_ACCEPT_NONBLOCK_POSIX_HPP
+#define LIBMINIMK_SYSCALL_ACCEPT_NONBLOCK_POSIX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_clearerrno
+#include <minimk/time.h>    // for minimk_time_monotonic_now
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for accept4
+
+#ifdef SOCK_NONBLOCK
+
+/// Testable minimk_syscall_accept_nonblock implementation.
+///
+/// This is the fast path using a single accept4 system call.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(accept4) M_sys_accept4 = accept4>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_accept_nonblock_impl( //
+        minimk_syscall_socket_t *client_sock, minimk_syscall_socket_t sock) noexcept {
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("accept4: t0=%lu\n", minimk_time_monotonic_now());
+    MINIMK_TRACE_SYSCALL("accept4: lfd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("accept4: flags=%s\n", "SOCK_NONBLOCK|SOCK_CLOEXEC");
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    *client_sock = M_sys_accept4(sock, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    // Assign the result of the syscall
+    minimk_error_t res = (*client_sock == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("accept4: t1=%lu\n", minimk_time_monotonic_now());
+    MINIMK_TRACE_SYSCALL("accept4: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("accept4: cfd=%d\n", *client_sock);
+
+    // Return the result
+    return res;
+}
+
+#else
+
+/// Testable minimk_syscall_accept_nonblock implementation.
+///
+/// This is the slow path using accept followed by fcntl.
+template <decltype(minimk_syscall_accept) M_accept = minimk_syscall_accept,
+          decltype(minimk_syscall_socket_setnonblock) M_setnonblock = minimk_syscall_socket_setnonblock,
+          decltype(minimk_syscall_closesocket) M_closesocket = minimk_syscall_closesocket>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_accept_nonblock_impl( //
+        minimk_syscall_socket_t *client_sock, minimk_syscall_socket_t sock) noexcept {
+    // Accept the connection
+    minimk_error_t res = M_accept(client_sock, sock);
+    if (res != 0) {
+        return res;
+    }
+
+    // Make the socket nonblocking and close it on failure
+    res = M_setnonblock(*client_sock);
+    if (res != 0) {
+        M_closesocket(client_sock);
+    }
+
+    // Return the result
+    return res;
+}
+
+#endif // SOCK_NONBLOCK
+
+#endif // LIBMINIMK_SYSCALL_ACCEPT_NONBLOCK_POSIX_HPP
@@ -0,0 +1,14 @@
+// File: libminimk/syscall/connect_addr_posix.cpp
+// Purpose: connect(2) implemented for POSIX using a pre-resolved address
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "connect_addr_posix.hpp" // for minimk_syscall_connect_addr_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_connect_addr
+
+minimk_error_t minimk_syscall_connect_addr( //
+        minimk_syscall_socket_t sock, const minimk_sockaddr_t *sa) noexcept {
+    return minimk_syscall_connect_addr_impl(sock, sa);
+}
@@ -0,0 +1,48 @@
+// File: libminimk/syscall/connect_addr_posix.hpp
+// Purpose: connect(2) on POSIX using a pre-resolved address
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_CONNECT_ADDR_POSIX_HPP
+#define LIBMINIMK_SYSCALL_CONNECT_ADDR_POSIX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_geterrno
+#include <minimk/time.h>     // for minimk_time_monotonic_now
+#include <minimk/trace.h>    // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for connect
+
+/// Testable minimk_syscall_connect_addr implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(connect) M_sys_connect = connect>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_connect_addr_impl(minimk_syscall_socket_t sock,
+                                                                     const minimk_sockaddr_t *sa) noexcept {
+    // Reject addresses that have not been parsed
+    if (sa->length <= 0) {
+        MINIMK_TRACE_SYSCALL("connect: invalid address for fd=%d\n", sock);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("connect: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("connect: addrlen=%u\n", sa->length);
+    MINIMK_TRACE_SYSCALL("connect: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_connect(sock, reinterpret_cast<const sockaddr *>(sa->storage), sa->length);
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("connect: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("connect: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_CONNECT_ADDR_POSIX_HPP
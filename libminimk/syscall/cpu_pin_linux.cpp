@@ -0,0 +1,14 @@
+// File: libminimk/syscall/cpu_pin_linux.cpp
+// Purpose: sched_setaffinity(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "cpu_pin_linux.hpp" // for minimk_syscall_cpu_pin_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_cpu_pin
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_cpu_pin(size_t cpu) noexcept {
+    return minimk_syscall_cpu_pin_impl(cpu);
+}
@@ -0,0 +1,48 @@
+// File: libminimk/syscall/cpu_pin_linux.hpp
+// Purpose: sched_setaffinity(2) on Linux for pinning to a CPU
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_CPU_PIN_LINUX_HPP
+#define LIBMINIMK_SYSCALL_CPU_PIN_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sched.h> // for sched_setaffinity
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_syscall_cpu_pin implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(sched_setaffinity) M_sys_sched_setaffinity = sched_setaffinity>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_cpu_pin_impl(size_t cpu) noexcept {
+    // As documented, reject CPUs that do not fit into the set
+    if (cpu >= CPU_SETSIZE) {
+        MINIMK_TRACE_SYSCALL("sched_setaffinity: suspicious cpu=%zu\n", cpu);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("sched_setaffinity: pid=%d\n", 0);
+    MINIMK_TRACE_SYSCALL("sched_setaffinity: cpu=%zu\n", cpu);
+
+    // Clear the errno and issue the syscall
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_sched_setaffinity(0, sizeof(set), &set);
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("sched_setaffinity: result=%s\n", minimk_errno_name(res));
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_CPU_PIN_LINUX_HPP
@@ -0,0 +1,14 @@
+// File: libminimk/syscall/cpu_span_linux.cpp
+// Purpose: sched_getaffinity(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "cpu_span_linux.hpp" // for minimk_syscall_cpu_span_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_cpu_span
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_cpu_span(size_t *span) noexcept {
+    return minimk_syscall_cpu_span_impl(span);
+}
@@ -0,0 +1,50 @@
+// File: libminimk/syscall/cpu_span_linux.hpp
+// Purpose: sched_getaffinity(2) on Linux for sizing per-CPU groups
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_CPU_SPAN_LINUX_HPP
+#define LIBMINIMK_SYSCALL_CPU_SPAN_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sched.h> // for sched_getaffinity
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_syscall_cpu_span implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(sched_getaffinity) M_sys_sched_getaffinity = sched_getaffinity>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_cpu_span_impl(size_t *span) noexcept {
+    // Initialize output parameter immediately
+    *span = 0;
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("sched_getaffinity: pid=%d\n", 0);
+
+    // Clear the errno and issue the syscall
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_sched_getaffinity(0, sizeof(set), &set);
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Walk the mask, since a restricted cpuset such as {2, 3} has holes and the
+    // steering program uses the raw CPU ID, so we need the highest ID plus one
+    for (size_t cpu = 0; rv == 0 && cpu < CPU_SETSIZE; cpu++) {
+        *span = CPU_ISSET(cpu, &set) ? cpu + 1 : *span;
+    }
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("sched_getaffinity: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("sched_getaffinity: span=%zu\n", *span);
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_CPU_SPAN_LINUX_HPP
@@ -0,0 +1,16 @@
+// File: libminimk/syscall/getsockopt_posix.cpp
+// Purpose: getsockopt(2) implemented for POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "getsockopt_posix.hpp" // for minimk_syscall_getsockopt_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/sockopt.h> // for minimk_sockopt_t
+#include <minimk/syscall.h> // for minimk_syscall_getsockopt
+
+#include <stdint.h> // for uint64_t
+
+minimk_error_t minimk_syscall_getsockopt(minimk_syscall_socket_t sock, minimk_sockopt_t option,
+                                         uint64_t *value) noexcept {
+    return minimk_syscall_getsockopt_impl(sock, option, value);
+}
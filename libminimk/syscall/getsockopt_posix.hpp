@@ -0,0 +1,64 @@
+// File: libminimk/syscall/getsockopt_posix.hpp
+// Purpose: getsockopt(2) on POSIX for typed socket options
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_GETSOCKOPT_POSIX_HPP
+#define LIBMINIMK_SYSCALL_GETSOCKOPT_POSIX_HPP
+
+#include "sockopt_posix.hpp" // for minimk_syscall_sockopt_lookup
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/sockopt.h> // for minimk_sockopt_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for getsockopt
+
+#include <stdint.h> // for uint32_t, uint64_t
+
+/// Testable minimk_syscall_getsockopt implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(getsockopt) M_sys_getsockopt = getsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_getsockopt_impl( //
+        minimk_syscall_socket_t sock, minimk_sockopt_t option, uint64_t *value) noexcept {
+    // Initialize output parameter immediately
+    *value = 0;
+
+    // Reject unknown options
+    sockopt_posix opt = {};
+    if (!minimk_syscall_sockopt_lookup(option, &opt)) {
+        MINIMK_TRACE_SYSCALL("getsockopt: suspicious fd=%d with option=%d\n", sock, option);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("getsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("getsockopt: level=%d\n", opt.level);
+    MINIMK_TRACE_SYSCALL("getsockopt: optname=%d\n", opt.name);
+
+    // Clear the errno and issue the syscall with a value of the proper size
+    uint64_t wide_value = 0;
+    int int_value = 0;
+    socklen_t len = (opt.wide != 0) ? sizeof(wide_value) : sizeof(int_value);
+    M_minimk_syscall_clearerrno();
+    int rv = (opt.wide != 0) ? M_sys_getsockopt(sock, opt.level, opt.name, &wide_value, &len)
+                             : M_sys_getsockopt(sock, opt.level, opt.name, &int_value, &len);
+
+    // Assign the result of the syscall, noting that the kernel may return a 32 bit
+    // value for wide options, which only fills the low bytes on little endian.
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+    if (res == 0) {
+        uint64_t wide_result = (len == sizeof(wide_value)) ? wide_value : static_cast<uint32_t>(wide_value);
+        *value = (opt.wide != 0) ? wide_result : static_cast<uint64_t>((int_value >= 0) ? int_value : 0);
+    }
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("getsockopt: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("getsockopt: value=%lu\n", *value);
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_GETSOCKOPT_POSIX_HPP
@@ -0,0 +1,14 @@
+// File: libminimk/syscall/getsockopt_tcp_info_linux.cpp
+// Purpose: getsockopt(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "getsockopt_tcp_info_linux.hpp" // for minimk_syscall_getsockopt_tcp_info_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_getsockopt_tcp_info
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_t
+
+minimk_error_t minimk_syscall_getsockopt_tcp_info(minimk_syscall_socket_t sock,
+                                                  minimk_tcpinfo_t *info) noexcept {
+    return minimk_syscall_getsockopt_tcp_info_impl(sock, info);
+}
@@ -0,0 +1,65 @@
+// File: libminimk/syscall/getsockopt_tcp_info_linux.hpp
+// Purpose: getsockopt(2) on Linux for TCP_INFO
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_GETSOCKOPT_TCP_INFO_LINUX_HPP
+#define LIBMINIMK_SYSCALL_GETSOCKOPT_TCP_INFO_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_t
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <linux/tcp.h>  // for struct tcp_info
+#include <netinet/in.h> // for IPPROTO_TCP
+#include <sys/socket.h> // for getsockopt
+
+/// Testable minimk_syscall_getsockopt_tcp_info implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(getsockopt) M_sys_getsockopt = getsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_getsockopt_tcp_info_impl( //
+        minimk_syscall_socket_t sock, minimk_tcpinfo_t *info) noexcept {
+    // Older kernels fill a prefix of the structure and leave the rest zeroed
+    struct tcp_info ti = {};
+    socklen_t tilen = sizeof(ti);
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("getsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("getsockopt: level=%s\n", "IPPROTO_TCP");
+    MINIMK_TRACE_SYSCALL("getsockopt: optname=%s\n", "TCP_INFO");
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_getsockopt(sock, IPPROTO_TCP, TCP_INFO, static_cast<void *>(&ti), &tilen);
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Convert to the portable representation, preserving the caller's timestamp
+    info->rtt = ti.tcpi_rtt;
+    info->rttvar = ti.tcpi_rttvar;
+    info->min_rtt = ti.tcpi_min_rtt;
+    info->snd_cwnd = ti.tcpi_snd_cwnd;
+    info->snd_mss = ti.tcpi_snd_mss;
+    info->bytes_acked = ti.tcpi_bytes_acked;
+    info->bytes_received = ti.tcpi_bytes_received;
+    info->bytes_sent = ti.tcpi_bytes_sent;
+    info->bytes_retrans = ti.tcpi_bytes_retrans;
+    info->total_retrans = ti.tcpi_total_retrans;
+    info->delivery_rate = ti.tcpi_delivery_rate;
+    info->pacing_rate = ti.tcpi_pacing_rate;
+    info->busy_time = ti.tcpi_busy_time;
+    info->rwnd_limited = ti.tcpi_rwnd_limited;
+    info->sndbuf_limited = ti.tcpi_sndbuf_limited;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("getsockopt: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("getsockopt: rtt=%u\n", ti.tcpi_rtt);
+    MINIMK_TRACE_SYSCALL("getsockopt: snd_cwnd=%u\n", ti.tcpi_snd_cwnd);
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_GETSOCKOPT_TCP_INFO_LINUX_HPP
@@ -0,0 +1,18 @@
+// File: libminimk/syscall/iovec_posix.hpp
+// Purpose: layout compatibility of minimk_iovec_t and struct iovec on POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_IOVEC_POSIX_HPP
+#define LIBMINIMK_SYSCALL_IOVEC_POSIX_HPP
+
+#include <minimk/iovec.h> // for minimk_iovec_t
+
+#include <sys/uio.h> // for struct iovec
+
+#include <stddef.h> // for offsetof
+
+// Ensure that we can pass minimk_iovec_t arrays directly to the kernel.
+static_assert(sizeof(minimk_iovec_t) == sizeof(struct iovec), "minimk_iovec_t size mismatch");
+static_assert(offsetof(minimk_iovec_t, base) == offsetof(struct iovec, iov_base), "base offset mismatch");
+static_assert(offsetof(minimk_iovec_t, len) == offsetof(struct iovec, iov_len), "len offset mismatch");
+
+#endif // LIBMINIMK_SYSCALL_IOVEC_POSIX_HPP
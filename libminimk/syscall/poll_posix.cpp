@@ -10,6 +10,7 @@
 short minimk_syscall_pollin = POLLIN;
 short minimk_syscall_pollout = POLLOUT;
 short minimk_syscall_pollerr = POLLERR;
+short minimk_syscall_pollhup = POLLHUP;
 
 minimk_error_t minimk_syscall_poll(minimk_syscall_pollfd_t *fds, size_t size, int timeout,
                                    size_t *nready) noexcept {
@@ -0,0 +1,17 @@
+// File: libminimk/syscall/recvfrom_gro_linux.cpp
+// Purpose: recvmsg(2) with UDP_GRO implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "recvfrom_gro_linux.hpp" // for minimk_syscall_recvfrom_gro_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_recvfrom_gro
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_recvfrom_gro( //
+        minimk_syscall_socket_t sock, void *data, size_t count, minimk_sockaddr_t *sa, size_t *segment_size,
+        size_t *nread) noexcept {
+    return minimk_syscall_recvfrom_gro_impl(sock, data, count, sa, segment_size, nread);
+}
@@ -0,0 +1,99 @@
+// File: libminimk/syscall/recvfrom_gro_linux.hpp
+// Purpose: recvmsg(2) on Linux with UDP_GRO
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_RECVFROM_GRO_LINUX_HPP
+#define LIBMINIMK_SYSCALL_RECVFROM_GRO_LINUX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_geterrno
+#include <minimk/time.h>     // for minimk_time_monotonic_now
+#include <minimk/trace.h>    // for MINIMK_TRACE_SYSCALL
+
+#include <netinet/in.h>  // for IPPROTO_UDP
+#include <netinet/udp.h> // for UDP_GRO
+#include <sys/socket.h>  // for recvmsg
+#include <sys/types.h>   // for ssize_t
+#include <sys/uio.h>     // for struct iovec
+
+#include <limits.h> // for SSIZE_MAX
+#include <stddef.h> // for size_t
+#include <string.h> // for memcpy
+
+// Older C libraries do not define UDP_GRO, which Linux supports since 5.0
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+/// Testable minimk_syscall_recvfrom_gro implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(recvmsg) M_sys_recvmsg = recvmsg>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_recvfrom_gro_impl( //
+        minimk_syscall_socket_t sock, void *data, size_t count, minimk_sockaddr_t *sa, size_t *segment_size,
+        size_t *nread) noexcept {
+    // Initialize output parameters immediately
+    *nread = 0;
+    *segment_size = 0;
+    *sa = {};
+
+    // As documented, reject zero-byte reads
+    if (count <= 0) {
+        MINIMK_TRACE_SYSCALL("recvmsg: suspicious fd=%d with zero bytes count=%zu\n", sock, count);
+        return MINIMK_EINVAL;
+    }
+
+    // Prepare the message header with a single buffer and room for the segment size
+    count = (count <= SSIZE_MAX) ? count : SSIZE_MAX;
+    struct iovec iov = {};
+    iov.iov_base = data;
+    iov.iov_len = count;
+    union {
+        char buf[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control = {};
+    struct msghdr msg = {};
+    msg.msg_name = sa->storage;
+    msg.msg_namelen = sizeof(sa->storage);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("recvmsg: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("recvmsg: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("recvmsg: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_recvmsg(sock, &msg, 0);
+
+    // Assign the result branchlessly, noting that zero-length datagrams are valid
+    *nread = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    sa->length = (rv >= 0) ? msg.msg_namelen : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Without coalescing, the whole buffer is a single datagram
+    *segment_size = *nread;
+    struct cmsghdr *cmsg = (res == 0) ? CMSG_FIRSTHDR(&msg) : nullptr;
+    for (; cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == IPPROTO_UDP && cmsg->cmsg_type == UDP_GRO) {
+            int gro_size = 0;
+            memcpy(&gro_size, CMSG_DATA(cmsg), sizeof(gro_size));
+            *segment_size = (gro_size > 0) ? static_cast<size_t>(gro_size) : *nread;
+        }
+    }
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("recvmsg: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("recvmsg: nread=%zu\n", *nread);
+    MINIMK_TRACE_SYSCALL("recvmsg: segment_size=%zu\n", *segment_size);
+    MINIMK_TRACE_SYSCALL("recvmsg: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_RECVFROM_GRO_LINUX_HPP
@@ -0,0 +1,16 @@
+// File: libminimk/syscall/recvfrom_posix.cpp
+// Purpose: recvfrom(2) implemented for POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "recvfrom_posix.hpp" // for minimk_syscall_recvfrom_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_recvfrom
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_recvfrom(minimk_syscall_socket_t sock, void *data, size_t count,
+                                       minimk_sockaddr_t *sa, size_t *nread) noexcept {
+    return minimk_syscall_recvfrom_impl(sock, data, count, sa, nread);
+}
@@ -0,0 +1,63 @@
+// File: libminimk/syscall/recvfrom_posix.hpp
+// Purpose: recvfrom(2) on POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_RECVFROM_POSIX_HPP
+#define LIBMINIMK_SYSCALL_RECVFROM_POSIX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_geterrno
+#include <minimk/time.h>     // for minimk_time_monotonic_now
+#include <minimk/trace.h>    // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for recvfrom
+#include <sys/types.h>  // for ssize_t
+
+#include <limits.h> // for SSIZE_MAX
+#include <stddef.h> // for size_t
+
+/// Testable minimk_syscall_recvfrom implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(recvfrom) M_sys_recvfrom = recvfrom>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_recvfrom_impl(minimk_syscall_socket_t sock, void *data,
+                                                                 size_t count, minimk_sockaddr_t *sa,
+                                                                 size_t *nread) noexcept {
+    // Initialize output parameters immediately
+    *nread = 0;
+    *sa = {};
+
+    // As documented, reject zero-byte reads
+    if (count <= 0) {
+        MINIMK_TRACE_SYSCALL("recvfrom: suspicious fd=%d with zero bytes count=%zu\n", sock, count);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to invoke the syscall
+    count = (count <= SSIZE_MAX) ? count : SSIZE_MAX;
+    MINIMK_TRACE_SYSCALL("recvfrom: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("recvfrom: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("recvfrom: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    socklen_t addrlen = sizeof(sa->storage);
+    ssize_t rv = M_sys_recvfrom(sock, data, count, 0, reinterpret_cast<sockaddr *>(sa->storage), &addrlen);
+
+    // Assign the result branchlessly, noting that zero-length datagrams are valid
+    *nread = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    sa->length = (rv >= 0) ? addrlen : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("recvfrom: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("recvfrom: nread=%zu\n", *nread);
+    MINIMK_TRACE_SYSCALL("recvfrom: addrlen=%u\n", sa->length);
+    MINIMK_TRACE_SYSCALL("recvfrom: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_RECVFROM_POSIX_HPP
@@ -0,0 +1,16 @@
+// File: libminimk/syscall/recvmmsg_linux.cpp
+// Purpose: recvmmsg(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "recvmmsg_linux.hpp" // for minimk_syscall_recvmmsg_impl
+
+#include <minimk/datagram.h> // for minimk_datagram_t
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/syscall.h>  // for minimk_syscall_recvmmsg
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_recvmmsg( //
+        minimk_syscall_socket_t sock, minimk_datagram_t *dgrams, size_t count, size_t *nrecv) noexcept {
+    return minimk_syscall_recvmmsg_impl(sock, dgrams, count, nrecv);
+}
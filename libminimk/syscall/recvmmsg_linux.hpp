@@ -0,0 +1,88 @@
+// File: libminimk/syscall/recvmmsg_linux.hpp
+// Purpose: recvmmsg(2) on Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_RECVMMSG_LINUX_HPP
+#define LIBMINIMK_SYSCALL_RECVMMSG_LINUX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/datagram.h> // for minimk_datagram_t
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/syscall.h>  // for minimk_syscall_geterrno
+#include <minimk/time.h>     // for minimk_time_monotonic_now
+#include <minimk/trace.h>    // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for recvmmsg
+#include <sys/uio.h>    // for struct iovec
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_syscall_recvmmsg implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(recvmmsg) M_sys_recvmmsg = recvmmsg>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_recvmmsg_impl(minimk_syscall_socket_t sock,
+                                                                 minimk_datagram_t *dgrams, size_t count,
+                                                                 size_t *nrecv) noexcept {
+    // Initialize output parameter immediately
+    *nrecv = 0;
+
+    // As documented, reject empty batches
+    if (count <= 0) {
+        MINIMK_TRACE_SYSCALL("recvmmsg: suspicious fd=%d with zero datagrams count=%zu\n", sock, count);
+        return MINIMK_EINVAL;
+    }
+
+    // Prepare the message headers, limiting the batch size to bound stack usage
+    count = (count <= MINIMK_DATAGRAM_BATCH_MAX) ? count : MINIMK_DATAGRAM_BATCH_MAX;
+    struct mmsghdr msgs[MINIMK_DATAGRAM_BATCH_MAX] = {};
+    struct iovec iovs[MINIMK_DATAGRAM_BATCH_MAX] = {};
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < count; idx++) {
+        // Reject datagrams with zero bytes
+        if (dgrams[idx].count <= 0) {
+            MINIMK_TRACE_SYSCALL("recvmmsg: invalid datagram index=%zu for fd=%d\n", idx, sock);
+            return MINIMK_EINVAL;
+        }
+        dgrams[idx].addr = {};
+        dgrams[idx].length = 0;
+        iovs[idx].iov_base = dgrams[idx].data;
+        iovs[idx].iov_len = dgrams[idx].count;
+        msgs[idx].msg_hdr.msg_name = dgrams[idx].addr.storage;
+        msgs[idx].msg_hdr.msg_namelen = sizeof(dgrams[idx].addr.storage);
+        msgs[idx].msg_hdr.msg_iov = &iovs[idx];
+        msgs[idx].msg_hdr.msg_iovlen = 1;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("recvmmsg: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("recvmmsg: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("recvmmsg: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall, which, since the socket is nonblocking,
+    // returns as soon as there are no more pending datagrams
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_recvmmsg(sock, msgs, static_cast<unsigned int>(count), 0, nullptr);
+
+    // Assign the result branchlessly
+    *nrecv = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Copy the number of bytes and the source address of each datagram
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < *nrecv; idx++) {
+        dgrams[idx].length = msgs[idx].msg_len;
+        dgrams[idx].addr.length = msgs[idx].msg_hdr.msg_namelen;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("recvmmsg: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("recvmmsg: nrecv=%zu\n", *nrecv);
+    MINIMK_TRACE_SYSCALL("recvmmsg: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_RECVMMSG_LINUX_HPP
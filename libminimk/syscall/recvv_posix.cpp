@@ -0,0 +1,16 @@
+// File: libminimk/syscall/recvv_posix.cpp
+// Purpose: recvmsg(2) with an iovec array implemented for POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "recvv_posix.hpp" // for minimk_syscall_recvv_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/iovec.h>   // for minimk_iovec_t
+#include <minimk/syscall.h> // for minimk_syscall_recvv
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_recvv(minimk_syscall_socket_t sock, minimk_iovec_t *iov, size_t iovcnt,
+                                    size_t *nread) noexcept {
+    return minimk_syscall_recvv_impl(sock, iov, iovcnt, nread);
+}
@@ -0,0 +1,71 @@
+// File: libminimk/syscall/recvv_posix.hpp
+// Purpose: recvmsg(2) with an iovec array on POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_RECVV_POSIX_HPP
+#define LIBMINIMK_SYSCALL_RECVV_POSIX_HPP
+
+#include "iovec_posix.hpp" // for struct iovec
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/iovec.h>   // for minimk_iovec_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/time.h>    // for minimk_time_monotonic_now
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for recvmsg
+#include <sys/types.h>  // for ssize_t
+#include <sys/uio.h>    // for struct iovec
+
+#include <limits.h> // for IOV_MAX
+
+/// Testable minimk_syscall_recvv implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(recvmsg) M_sys_recvmsg = recvmsg>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_recvv_impl( //
+        minimk_syscall_socket_t sock, minimk_iovec_t *iov, size_t iovcnt, size_t *nread) noexcept {
+    // Initialize output parameter immediately
+    *nread = 0;
+
+    // As documented, reject zero-byte reads
+    if (minimk_iovec_total(iov, iovcnt) <= 0) {
+        MINIMK_TRACE_SYSCALL("recvmsg: suspicious fd=%d with zero bytes iovcnt=%zu\n", sock, iovcnt);
+        return MINIMK_EINVAL;
+    }
+
+    // Prepare flags - start with none, add MSG_NOSIGNAL if available
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags |= MSG_NOSIGNAL;
+#endif
+
+    // Prepare the message header, limiting the number of buffers to what the kernel accepts
+    iovcnt = (iovcnt <= IOV_MAX) ? iovcnt : IOV_MAX;
+    struct msghdr msg = {};
+    msg.msg_iov = reinterpret_cast<struct iovec *>(const_cast<minimk_iovec_t *>(iov));
+    msg.msg_iovlen = iovcnt;
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("recvmsg: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("recvmsg: iovcnt=%zu\n", iovcnt);
+    MINIMK_TRACE_SYSCALL("recvmsg: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_recvmsg(sock, &msg, flags);
+
+    // Assign the result branchlessly
+    *nread = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : (rv == 0) ? MINIMK_EOF : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("recvmsg: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("recvmsg: nread=%zu\n", *nread);
+    MINIMK_TRACE_SYSCALL("recvmsg: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_RECVV_POSIX_HPP
@@ -0,0 +1,15 @@
+// File: libminimk/syscall/send_zerocopy_linux.cpp
+// Purpose: send(2) with MSG_ZEROCOPY implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "send_zerocopy_linux.hpp" // for minimk_syscall_send_zerocopy_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_send_zerocopy
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_send_zerocopy(minimk_syscall_socket_t sock, const void *data, size_t count,
+                                            size_t *nwritten) noexcept {
+    return minimk_syscall_send_zerocopy_impl(sock, data, count, nwritten);
+}
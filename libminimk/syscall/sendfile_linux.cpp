@@ -0,0 +1,16 @@
+// File: libminimk/syscall/sendfile_linux.cpp
+// Purpose: sendfile(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendfile_linux.hpp" // for minimk_syscall_sendfile_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_sendfile
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint64_t
+
+minimk_error_t minimk_syscall_sendfile(minimk_syscall_socket_t sock, minimk_syscall_socket_t fd,
+                                       uint64_t offset, size_t count, size_t *nwritten) noexcept {
+    return minimk_syscall_sendfile_impl(sock, fd, offset, count, nwritten);
+}
@@ -0,0 +1,63 @@
+// File: libminimk/syscall/sendfile_linux.hpp
+// Purpose: sendfile(2) on Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SENDFILE_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SENDFILE_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/time.h>    // for minimk_time_monotonic_now
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/sendfile.h> // for sendfile
+#include <sys/types.h>    // for off_t, ssize_t
+
+#include <limits.h> // for SSIZE_MAX
+#include <stddef.h> // for size_t
+#include <stdint.h> // for INT64_MAX, uint64_t
+
+/// Testable minimk_syscall_sendfile implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(sendfile) M_sys_sendfile = sendfile>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_sendfile_impl( //
+        minimk_syscall_socket_t sock, minimk_syscall_socket_t fd, uint64_t offset, size_t count,
+        size_t *nwritten) noexcept {
+    // Initialize output parameter immediately
+    *nwritten = 0;
+
+    // As documented, reject zero-byte writes and offsets not fitting into off_t
+    static_assert(sizeof(off_t) == sizeof(int64_t), "off_t must be 64 bit");
+    if (count <= 0 || offset > static_cast<uint64_t>(INT64_MAX)) {
+        MINIMK_TRACE_SYSCALL("sendfile: suspicious fd=%d with count=%zu offset=%lu\n", sock, count, offset);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to invoke the syscall
+    count = (count <= SSIZE_MAX) ? count : SSIZE_MAX;
+    off_t off = static_cast<off_t>(offset);
+    MINIMK_TRACE_SYSCALL("sendfile: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("sendfile: in_fd=%d\n", fd);
+    MINIMK_TRACE_SYSCALL("sendfile: offset=%lu\n", offset);
+    MINIMK_TRACE_SYSCALL("sendfile: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("sendfile: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_sendfile(sock, fd, &off, count);
+
+    // Assign the result branchlessly, noting that zero means we are past the end of file
+    *nwritten = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : (rv == 0) ? MINIMK_EOF : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("sendfile: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("sendfile: nwritten=%zu\n", *nwritten);
+    MINIMK_TRACE_SYSCALL("sendfile: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SENDFILE_LINUX_HPP
@@ -0,0 +1,91 @@
+// File: libminimk/syscall/sendmmsg_linux.hpp
+// Purpose: sendmmsg(2) on Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SENDMMSG_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SENDMMSG_LINUX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/datagram.h> // for minimk_datagram_t
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/syscall.h>  // for minimk_syscall_geterrno
+#include <minimk/time.h>     // for minimk_time_monotonic_now
+#include <minimk/trace.h>    // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for sendmmsg
+#include <sys/uio.h>    // for struct iovec
+
+#include <stddef.h> // for size_t
+
+/// Testable minimk_syscall_sendmmsg implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(sendmmsg) M_sys_sendmmsg = sendmmsg>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_sendmmsg_impl(minimk_syscall_socket_t sock,
+                                                                 minimk_datagram_t *dgrams, size_t count,
+                                                                 size_t *nsent) noexcept {
+    // Initialize output parameter immediately
+    *nsent = 0;
+
+    // As documented, reject empty batches
+    if (count <= 0) {
+        MINIMK_TRACE_SYSCALL("sendmmsg: suspicious fd=%d with zero datagrams count=%zu\n", sock, count);
+        return MINIMK_EINVAL;
+    }
+
+    // Prepare flags - start with none, add MSG_NOSIGNAL if available
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags |= MSG_NOSIGNAL;
+#endif
+
+    // Prepare the message headers, limiting the batch size to bound stack usage
+    count = (count <= MINIMK_DATAGRAM_BATCH_MAX) ? count : MINIMK_DATAGRAM_BATCH_MAX;
+    struct mmsghdr msgs[MINIMK_DATAGRAM_BATCH_MAX] = {};
+    struct iovec iovs[MINIMK_DATAGRAM_BATCH_MAX] = {};
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < count; idx++) {
+        // Reject datagrams without a parsed address or with zero bytes
+        if (dgrams[idx].addr.length <= 0 || dgrams[idx].count <= 0) {
+            MINIMK_TRACE_SYSCALL("sendmmsg: invalid datagram index=%zu for fd=%d\n", idx, sock);
+            return MINIMK_EINVAL;
+        }
+        dgrams[idx].length = 0;
+        iovs[idx].iov_base = dgrams[idx].data;
+        iovs[idx].iov_len = dgrams[idx].count;
+        msgs[idx].msg_hdr.msg_name = dgrams[idx].addr.storage;
+        msgs[idx].msg_hdr.msg_namelen = dgrams[idx].addr.length;
+        msgs[idx].msg_hdr.msg_iov = &iovs[idx];
+        msgs[idx].msg_hdr.msg_iovlen = 1;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("sendmmsg: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("sendmmsg: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("sendmmsg: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_sendmmsg(sock, msgs, static_cast<unsigned int>(count), flags);
+
+    // Assign the result branchlessly
+    *nsent = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Copy the number of bytes sent for each datagram
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < *nsent; idx++) {
+        dgrams[idx].length = msgs[idx].msg_len;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("sendmmsg: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("sendmmsg: nsent=%zu\n", *nsent);
+    MINIMK_TRACE_SYSCALL("sendmmsg: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SENDMMSG_LINUX_HPP
@@ -0,0 +1,17 @@
+// File: libminimk/syscall/sendto_gso_linux.cpp
+// Purpose: sendmsg(2) with UDP_SEGMENT implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendto_gso_linux.hpp" // for minimk_syscall_sendto_gso_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_sendto_gso
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_sendto_gso( //
+        minimk_syscall_socket_t sock, const void *data, size_t count, const minimk_sockaddr_t *sa,
+        size_t segment_size, size_t *nwritten) noexcept {
+    return minimk_syscall_sendto_gso_impl(sock, data, count, sa, segment_size, nwritten);
+}
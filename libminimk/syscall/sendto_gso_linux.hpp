@@ -0,0 +1,106 @@
+// File: libminimk/syscall/sendto_gso_linux.hpp
+// Purpose: sendmsg(2) on Linux with UDP_SEGMENT
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SENDTO_GSO_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SENDTO_GSO_LINUX_HPP
+
+#include <minimk/cdefs.h>    // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_geterrno
+#include <minimk/time.h>     // for minimk_time_monotonic_now
+#include <minimk/trace.h>    // for MINIMK_TRACE_SYSCALL
+
+#include <netinet/in.h>  // for IPPROTO_UDP
+#include <netinet/udp.h> // for UDP_SEGMENT
+#include <sys/socket.h>  // for sendmsg
+#include <sys/types.h>   // for ssize_t
+#include <sys/uio.h>     // for struct iovec
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint16_t
+#include <string.h> // for memcpy
+
+// Older C libraries do not define UDP_SEGMENT, which Linux supports since 4.18
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+
+/// Testable minimk_syscall_sendto_gso implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(sendmsg) M_sys_sendmsg = sendmsg>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_sendto_gso_impl( //
+        minimk_syscall_socket_t sock, const void *data, size_t count, const minimk_sockaddr_t *sa,
+        size_t segment_size, size_t *nwritten) noexcept {
+    // Initialize output parameter immediately
+    *nwritten = 0;
+
+    // As documented, reject zero-byte writes and invalid segment sizes
+    if (count <= 0 || segment_size <= 0 || segment_size > UINT16_MAX) {
+        MINIMK_TRACE_SYSCALL("sendmsg: suspicious fd=%d count=%zu\n", sock, count);
+        MINIMK_TRACE_SYSCALL("sendmsg: suspicious segment_size=%zu\n", segment_size);
+        return MINIMK_EINVAL;
+    }
+
+    // Reject addresses that have not been parsed
+    if (sa->length <= 0) {
+        MINIMK_TRACE_SYSCALL("sendmsg: invalid address for fd=%d\n", sock);
+        return MINIMK_EINVAL;
+    }
+
+    // Prepare flags - start with none, add MSG_NOSIGNAL if available
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags |= MSG_NOSIGNAL;
+#endif
+
+    // Prepare the message header with a single buffer
+    struct iovec iov = {};
+    iov.iov_base = const_cast<void *>(data);
+    iov.iov_len = count;
+    struct msghdr msg = {};
+    msg.msg_name = const_cast<uint64_t *>(sa->storage);
+    msg.msg_namelen = sa->length;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    // Attach the segment size, which tells the kernel to split the buffer
+    // into datagrams of segment_size bytes, except possibly the last one
+    union {
+        char buf[CMSG_SPACE(sizeof(uint16_t))];
+        struct cmsghdr align;
+    } control = {};
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = IPPROTO_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+    uint16_t gso_size = static_cast<uint16_t>(segment_size);
+    memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("sendmsg: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("sendmsg: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("sendmsg: segment_size=%zu\n", segment_size);
+    MINIMK_TRACE_SYSCALL("sendmsg: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_sendmsg(sock, &msg, flags);
+
+    // Assign the result branchlessly
+    *nwritten = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("sendmsg: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("sendmsg: nwritten=%zu\n", *nwritten);
+    MINIMK_TRACE_SYSCALL("sendmsg: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SENDTO_GSO_LINUX_HPP
@@ -0,0 +1,16 @@
+// File: libminimk/syscall/sendto_posix.cpp
+// Purpose: sendto(2) implemented for POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendto_posix.hpp" // for minimk_syscall_sendto_impl
+
+#include <minimk/errno.h>    // for minimk_error_t
+#include <minimk/sockaddr.h> // for minimk_sockaddr_t
+#include <minimk/syscall.h>  // for minimk_syscall_sendto
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_sendto(minimk_syscall_socket_t sock, const void *data, size_t count,
+                                     const minimk_sockaddr_t *sa, size_t *nwritten) noexcept {
+    return minimk_syscall_sendto_impl(sock, data, count, sa, nwritten);
+}
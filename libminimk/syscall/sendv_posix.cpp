@@ -0,0 +1,16 @@
+// File: libminimk/syscall/sendv_posix.cpp
+// Purpose: sendmsg(2) with an iovec array implemented for POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sendv_posix.hpp" // for minimk_syscall_sendv_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/iovec.h>   // for minimk_iovec_t
+#include <minimk/syscall.h> // for minimk_syscall_sendv
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_sendv(minimk_syscall_socket_t sock, const minimk_iovec_t *iov, size_t iovcnt,
+                                    size_t *nwritten) noexcept {
+    return minimk_syscall_sendv_impl(sock, iov, iovcnt, nwritten);
+}
@@ -0,0 +1,13 @@
+// File: libminimk/syscall/setsockopt_congestion_linux.cpp
+// Purpose: setsockopt(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_congestion_linux.hpp" // for minimk_syscall_setsockopt_congestion_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_setsockopt_congestion
+
+minimk_error_t minimk_syscall_setsockopt_congestion(minimk_syscall_socket_t sock,
+                                                    const char *algorithm) noexcept {
+    return minimk_syscall_setsockopt_congestion_impl(sock, algorithm);
+}
@@ -0,0 +1,45 @@
+// File: libminimk/syscall/setsockopt_congestion_linux.hpp
+// Purpose: setsockopt(2) on Linux for TCP_CONGESTION
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SETSOCKOPT_CONGESTION_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SETSOCKOPT_CONGESTION_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <netinet/in.h>  // for IPPROTO_TCP
+#include <netinet/tcp.h> // for TCP_CONGESTION
+#include <sys/socket.h>  // for setsockopt
+
+#include <string.h> // for strlen
+
+/// Testable minimk_syscall_setsockopt_congestion implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(setsockopt) M_sys_setsockopt = setsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_syscall_setsockopt_congestion_impl(minimk_syscall_socket_t sock, const char *algorithm) noexcept {
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("setsockopt: level=%s\n", "IPPROTO_TCP");
+    MINIMK_TRACE_SYSCALL("setsockopt: optname=%s\n", "TCP_CONGESTION");
+    MINIMK_TRACE_SYSCALL("setsockopt: algorithm=%s\n", algorithm);
+
+    // Set TCP_CONGESTION, which does not need the terminating zero
+    M_minimk_syscall_clearerrno();
+    socklen_t len = static_cast<socklen_t>(strlen(algorithm));
+    int rv = M_sys_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, algorithm, len);
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: result=%s\n", minimk_errno_name(res));
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SETSOCKOPT_CONGESTION_LINUX_HPP
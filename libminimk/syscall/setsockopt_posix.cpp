@@ -0,0 +1,16 @@
+// File: libminimk/syscall/setsockopt_posix.cpp
+// Purpose: setsockopt(2) implemented for POSIX
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_posix.hpp" // for minimk_syscall_setsockopt_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/sockopt.h> // for minimk_sockopt_t
+#include <minimk/syscall.h> // for minimk_syscall_setsockopt
+
+#include <stdint.h> // for uint64_t
+
+minimk_error_t minimk_syscall_setsockopt(minimk_syscall_socket_t sock, minimk_sockopt_t option,
+                                         uint64_t value) noexcept {
+    return minimk_syscall_setsockopt_impl(sock, option, value);
+}
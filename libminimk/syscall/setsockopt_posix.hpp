@@ -0,0 +1,55 @@
+// File: libminimk/syscall/setsockopt_posix.hpp
+// Purpose: setsockopt(2) on POSIX for typed socket options
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SETSOCKOPT_POSIX_HPP
+#define LIBMINIMK_SYSCALL_SETSOCKOPT_POSIX_HPP
+
+#include "sockopt_posix.hpp" // for minimk_syscall_sockopt_lookup
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/sockopt.h> // for minimk_sockopt_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for setsockopt
+
+#include <limits.h> // for INT_MAX
+#include <stdint.h> // for uint64_t
+
+/// Testable minimk_syscall_setsockopt implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(setsockopt) M_sys_setsockopt = setsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_setsockopt_impl( //
+        minimk_syscall_socket_t sock, minimk_sockopt_t option, uint64_t value) noexcept {
+    // Reject unknown options and values that do not fit
+    sockopt_posix opt = {};
+    if (!minimk_syscall_sockopt_lookup(option, &opt) || (opt.wide == 0 && value > INT_MAX)) {
+        MINIMK_TRACE_SYSCALL("setsockopt: suspicious fd=%d with option=%d value=%lu\n", sock, option, value);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("setsockopt: level=%d\n", opt.level);
+    MINIMK_TRACE_SYSCALL("setsockopt: optname=%d\n", opt.name);
+    MINIMK_TRACE_SYSCALL("setsockopt: value=%lu\n", value);
+
+    // Clear the errno and issue the syscall with a value of the proper size
+    int int_value = static_cast<int>(value);
+    M_minimk_syscall_clearerrno();
+    int rv = (opt.wide != 0) ? M_sys_setsockopt(sock, opt.level, opt.name, &value, sizeof(value))
+                             : M_sys_setsockopt(sock, opt.level, opt.name, &int_value, sizeof(int_value));
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: result=%s\n", minimk_errno_name(res));
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SETSOCKOPT_POSIX_HPP
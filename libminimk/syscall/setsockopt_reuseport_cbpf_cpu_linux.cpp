@@ -0,0 +1,12 @@
+// File: libminimk/syscall/setsockopt_reuseport_cbpf_cpu_linux.cpp
+// Purpose: setsockopt(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "setsockopt_reuseport_cbpf_cpu_linux.hpp" // for minimk_syscall_setsockopt_reuseport_cbpf_cpu_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_setsockopt_reuseport_cbpf_cpu
+
+minimk_error_t minimk_syscall_setsockopt_reuseport_cbpf_cpu(minimk_syscall_socket_t sock) noexcept {
+    return minimk_syscall_setsockopt_reuseport_cbpf_cpu_impl(sock);
+}
@@ -0,0 +1,60 @@
+// File: libminimk/syscall/setsockopt_reuseport_cbpf_cpu_linux.hpp
+// Purpose: setsockopt(2) on Linux for SO_ATTACH_REUSEPORT_CBPF steering by CPU
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SETSOCKOPT_REUSEPORT_CBPF_CPU_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SETSOCKOPT_REUSEPORT_CBPF_CPU_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <linux/filter.h> // for struct sock_fprog
+#include <sys/socket.h>   // for setsockopt
+
+#include <stdint.h> // for uint16_t, uint32_t
+
+// Older C libraries do not define SO_ATTACH_REUSEPORT_CBPF, which Linux supports since 4.5
+#ifndef SO_ATTACH_REUSEPORT_CBPF
+#define SO_ATTACH_REUSEPORT_CBPF 51
+#endif
+
+/// Testable minimk_syscall_setsockopt_reuseport_cbpf_cpu implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(setsockopt) M_sys_setsockopt = setsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_syscall_setsockopt_reuseport_cbpf_cpu_impl(minimk_syscall_socket_t sock) noexcept {
+    // Steer each connection to the socket whose index in the group equals the
+    // CPU processing the packet. Out of range indexes fall back to hashing.
+    uint32_t cpu = static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU);
+    struct sock_filter code[] = {
+            // A = current CPU
+            {static_cast<uint16_t>(BPF_LD | BPF_W | BPF_ABS), 0, 0, cpu},
+            // return A
+            {static_cast<uint16_t>(BPF_RET | BPF_A), 0, 0, 0},
+    };
+    struct sock_fprog prog = {};
+    prog.len = sizeof(code) / sizeof(code[0]);
+    prog.filter = code;
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("setsockopt: level=%s\n", "SOL_SOCKET");
+    MINIMK_TRACE_SYSCALL("setsockopt: optname=%s\n", "SO_ATTACH_REUSEPORT_CBPF");
+
+    // Attach the program, which applies to the whole reuseport group
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_setsockopt(sock, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog));
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: result=%s\n", minimk_errno_name(res));
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SETSOCKOPT_REUSEPORT_CBPF_CPU_LINUX_HPP
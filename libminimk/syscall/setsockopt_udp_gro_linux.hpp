@@ -0,0 +1,47 @@
+// File: libminimk/syscall/setsockopt_udp_gro_linux.hpp
+// Purpose: setsockopt(2) on Linux for UDP_GRO
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SETSOCKOPT_UDP_GRO_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SETSOCKOPT_UDP_GRO_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <netinet/in.h>  // for IPPROTO_UDP
+#include <netinet/udp.h> // for UDP_GRO
+#include <sys/socket.h>  // for setsockopt
+
+// Older C libraries do not define UDP_GRO, which Linux supports since 5.0
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+/// Testable minimk_syscall_setsockopt_udp_gro implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(setsockopt) M_sys_setsockopt = setsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_syscall_setsockopt_udp_gro_impl(minimk_syscall_socket_t sock) noexcept {
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("setsockopt: level=%s\n", "IPPROTO_UDP");
+    MINIMK_TRACE_SYSCALL("setsockopt: optname=%s\n", "UDP_GRO");
+
+    // Set UDP_GRO to allow the kernel to coalesce received datagrams
+    int on = 1;
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_setsockopt(sock, IPPROTO_UDP, UDP_GRO, &on, sizeof(on));
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: result=%s\n", minimk_errno_name(res));
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SETSOCKOPT_UDP_GRO_LINUX_HPP
@@ -0,0 +1,45 @@
+// File: libminimk/syscall/setsockopt_zerocopy_linux.hpp
+// Purpose: setsockopt(2) on Linux for SO_ZEROCOPY
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SETSOCKOPT_ZEROCOPY_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SETSOCKOPT_ZEROCOPY_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/socket.h> // for setsockopt
+
+// Older C libraries do not define SO_ZEROCOPY, which Linux supports since 4.14
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+
+/// Testable minimk_syscall_setsockopt_zerocopy implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(setsockopt) M_sys_setsockopt = setsockopt>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_syscall_setsockopt_zerocopy_impl(minimk_syscall_socket_t sock) noexcept {
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("setsockopt: level=%s\n", "SOL_SOCKET");
+    MINIMK_TRACE_SYSCALL("setsockopt: optname=%s\n", "SO_ZEROCOPY");
+
+    // Set SO_ZEROCOPY to allow sending with MSG_ZEROCOPY
+    int on = 1;
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_setsockopt(sock, SOL_SOCKET, SO_ZEROCOPY, &on, sizeof(on));
+
+    // Assign the result of the syscall
+    minimk_error_t res = (rv == 0) ? 0 : M_minimk_syscall_geterrno();
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("setsockopt: result=%s\n", minimk_errno_name(res));
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SETSOCKOPT_ZEROCOPY_LINUX_HPP
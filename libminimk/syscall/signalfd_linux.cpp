@@ -0,0 +1,12 @@
+// File: libminimk/syscall/signalfd_linux.cpp
+// Purpose: signalfd(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "signalfd_linux.hpp" // for minimk_syscall_signalfd_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_signalfd
+
+minimk_error_t minimk_syscall_signalfd(minimk_syscall_socket_t *fd, int signo) noexcept {
+    return minimk_syscall_signalfd_impl(fd, signo);
+}
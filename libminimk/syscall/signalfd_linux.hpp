@@ -0,0 +1,72 @@
+// File: libminimk/syscall/signalfd_linux.hpp
+// Purpose: signalfd(2) on Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SIGNALFD_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SIGNALFD_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/signalfd.h> // for signalfd
+
+#include <signal.h> // for sigprocmask
+
+/// Testable minimk_syscall_signalfd implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(sigprocmask) M_sys_sigprocmask = sigprocmask, decltype(signalfd) M_sys_signalfd = signalfd>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_signalfd_impl(minimk_syscall_socket_t *fd,
+                                                                 int signo) noexcept {
+    // Initialize output parameter immediately
+    *fd = -1;
+
+    // Create the mask containing just the given signal
+    sigset_t mask;
+    sigemptyset(&mask);
+    if (sigaddset(&mask, signo) != 0) {
+        MINIMK_TRACE_SYSCALL("signalfd: invalid signo=%d\n", signo);
+        return MINIMK_EINVAL;
+    }
+
+    // Log that we're about to block the signal
+    MINIMK_TRACE_SYSCALL("sigprocmask: how=%s\n", "SIG_BLOCK");
+    MINIMK_TRACE_SYSCALL("sigprocmask: signo=%d\n", signo);
+
+    // Block the signal such that it is only delivered through the descriptor
+    sigset_t oldmask;
+    sigemptyset(&oldmask);
+    M_minimk_syscall_clearerrno();
+    if (M_sys_sigprocmask(SIG_BLOCK, &mask, &oldmask) != 0) {
+        minimk_error_t res = M_minimk_syscall_geterrno();
+        MINIMK_TRACE_SYSCALL("sigprocmask: result=%s\n", minimk_errno_name(res));
+        return res;
+    }
+
+    // Log the result of blocking the signal
+    MINIMK_TRACE_SYSCALL("sigprocmask: result=%s\n", minimk_errno_name(0));
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    int rv = M_sys_signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+
+    // Assign the result of the syscall
+    *fd = rv;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("signalfd: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("signalfd: fd=%d\n", *fd);
+
+    // Without a descriptor nobody could receive the signal, so unblock it
+    if (res != 0) {
+        MINIMK_TRACE_SYSCALL("sigprocmask: how=%s\n", "SIG_SETMASK");
+        (void)M_sys_sigprocmask(SIG_SETMASK, &oldmask, nullptr);
+    }
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SIGNALFD_LINUX_HPP
@@ -0,0 +1,12 @@
+// File: libminimk/syscall/signalfd_read_linux.cpp
+// Purpose: read(2) of a signalfd(2) descriptor implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "signalfd_read_linux.hpp" // for minimk_syscall_signalfd_read_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_signalfd_read
+
+minimk_error_t minimk_syscall_signalfd_read(minimk_syscall_socket_t fd, int *signo) noexcept {
+    return minimk_syscall_signalfd_read_impl(fd, signo);
+}
@@ -0,0 +1,48 @@
+// File: libminimk/syscall/signalfd_read_linux.hpp
+// Purpose: read(2) of a signalfd(2) descriptor on Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SIGNALFD_READ_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SIGNALFD_READ_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <sys/signalfd.h> // for struct signalfd_siginfo
+#include <sys/types.h>    // for ssize_t
+
+#include <unistd.h> // for read
+
+/// Testable minimk_syscall_signalfd_read implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(read) M_sys_read = read>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_signalfd_read_impl(minimk_syscall_socket_t fd,
+                                                                      int *signo) noexcept {
+    // Initialize output parameter immediately
+    *signo = 0;
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("read: fd=%d\n", fd);
+
+    // Clear the errno and issue the syscall
+    struct signalfd_siginfo info = {};
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_read(fd, &info, sizeof(info));
+
+    // The kernel only returns whole structures, so anything else is unexpected
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno()
+                         : (rv != static_cast<ssize_t>(sizeof(info))) ? MINIMK_EINVAL
+                                                                       : 0;
+    *signo = (res == 0) ? static_cast<int>(info.ssi_signo) : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("read: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("read: signo=%d\n", *signo);
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SIGNALFD_READ_LINUX_HPP
@@ -11,3 +11,8 @@ minimk_error_t minimk_syscall_socket(minimk_syscall_socket_t *sock, int domain,
                                      int protocol) noexcept {
     return minimk_syscall_socket_impl(sock, domain, type, protocol);
 }
+
+minimk_error_t minimk_syscall_socket_nonblock(minimk_syscall_socket_t *sock, int domain, int type,
+                                              int protocol) noexcept {
+    return minimk_syscall_socket_nonblock_impl(sock, domain, type, protocol);
+}
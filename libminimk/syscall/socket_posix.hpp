@@ -38,4 +38,43 @@ MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_socket_impl(minimk_syscall_so
     return res;
 }
 
+#ifdef SOCK_NONBLOCK
+
+/// Testable minimk_syscall_socket_nonblock implementation.
+///
+/// This is the fast path passing SOCK_NONBLOCK and SOCK_CLOEXEC to socket.
+template <decltype(minimk_syscall_socket) M_socket = minimk_syscall_socket>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_socket_nonblock_impl( //
+        minimk_syscall_socket_t *sock, int domain, int type, int protocol) noexcept {
+    return M_socket(sock, domain, type | SOCK_NONBLOCK | SOCK_CLOEXEC, protocol);
+}
+
+#else
+
+/// Testable minimk_syscall_socket_nonblock implementation.
+///
+/// This is the slow path using socket followed by fcntl.
+template <decltype(minimk_syscall_socket) M_socket = minimk_syscall_socket,
+          decltype(minimk_syscall_socket_setnonblock) M_setnonblock = minimk_syscall_socket_setnonblock,
+          decltype(minimk_syscall_closesocket) M_closesocket = minimk_syscall_closesocket>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_socket_nonblock_impl( //
+        minimk_syscall_socket_t *sock, int domain, int type, int protocol) noexcept {
+    // Create the socket
+    minimk_error_t res = M_socket(sock, domain, type, protocol);
+    if (res != 0) {
+        return res;
+    }
+
+    // Make the socket nonblocking and close it on failure
+    res = M_setnonblock(*sock);
+    if (res != 0) {
+        M_closesocket(sock);
+    }
+
+    // Return the result
+    return res;
+}
+
+#endif // SOCK_NONBLOCK
+
 #endif // LIBMINIMK_SYSCALL_SOCKET_POSIX_HPP
@@ -0,0 +1,72 @@
+// File: libminimk/syscall/sockopt_posix.hpp
+// Purpose: mapping of typed socket options to setsockopt(2) levels and names
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SOCKOPT_POSIX_HPP
+#define LIBMINIMK_SYSCALL_SOCKOPT_POSIX_HPP
+
+#include <minimk/sockopt.h> // for MINIMK_SOCKOPT_*
+
+#include <netinet/in.h>  // for IPPROTO_TCP
+#include <netinet/tcp.h> // for TCP_NODELAY
+#include <sys/socket.h>  // for SOL_SOCKET
+
+#include <stdint.h> // for uint32_t
+
+/// Level, name, and value size of a socket option.
+struct sockopt_posix {
+    /// The level argument of setsockopt (e.g., SOL_SOCKET).
+    int level;
+
+    /// The optname argument of setsockopt (e.g., SO_SNDBUF).
+    int name;
+
+    /// Nonzero when the value is 64 bit rather than an int.
+    uint32_t wide;
+};
+
+/// Maps the given typed option to its level and name or returns false when the
+/// option is unknown or not supported by this system.
+static inline bool minimk_syscall_sockopt_lookup(minimk_sockopt_t option, sockopt_posix *opt) noexcept {
+    *opt = {};
+    switch (option) {
+    case MINIMK_SOCKOPT_TCP_NODELAY:
+        *opt = {IPPROTO_TCP, TCP_NODELAY, 0};
+        return true;
+#ifdef TCP_CORK
+    case MINIMK_SOCKOPT_TCP_CORK:
+        *opt = {IPPROTO_TCP, TCP_CORK, 0};
+        return true;
+#endif
+    case MINIMK_SOCKOPT_SNDBUF:
+        *opt = {SOL_SOCKET, SO_SNDBUF, 0};
+        return true;
+    case MINIMK_SOCKOPT_RCVBUF:
+        *opt = {SOL_SOCKET, SO_RCVBUF, 0};
+        return true;
+#ifdef TCP_NOTSENT_LOWAT
+    case MINIMK_SOCKOPT_TCP_NOTSENT_LOWAT:
+        *opt = {IPPROTO_TCP, TCP_NOTSENT_LOWAT, 0};
+        return true;
+#endif
+#ifdef SO_MAX_PACING_RATE
+    case MINIMK_SOCKOPT_MAX_PACING_RATE:
+        // Linux accepts a 64 bit value since 4.20, which avoids capping at 4 GB/s
+        *opt = {SOL_SOCKET, SO_MAX_PACING_RATE, 1};
+        return true;
+#endif
+#ifdef SO_BUSY_POLL
+    case MINIMK_SOCKOPT_BUSY_POLL:
+        *opt = {SOL_SOCKET, SO_BUSY_POLL, 0};
+        return true;
+#endif
+#ifdef SO_REUSEPORT
+    case MINIMK_SOCKOPT_REUSEPORT:
+        *opt = {SOL_SOCKET, SO_REUSEPORT, 0};
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+#endif // LIBMINIMK_SYSCALL_SOCKOPT_POSIX_HPP
@@ -0,0 +1,15 @@
+// File: libminimk/syscall/splice_linux.cpp
+// Purpose: splice(2) implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "splice_linux.hpp" // for minimk_syscall_splice_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_splice
+
+#include <stddef.h> // for size_t
+
+minimk_error_t minimk_syscall_splice(minimk_syscall_socket_t pipefd, minimk_syscall_socket_t sock,
+                                     size_t count, size_t *nwritten) noexcept {
+    return minimk_syscall_splice_impl(pipefd, sock, count, nwritten);
+}
@@ -0,0 +1,62 @@
+// File: libminimk/syscall/splice_linux.hpp
+// Purpose: splice(2) on Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_SPLICE_LINUX_HPP
+#define LIBMINIMK_SYSCALL_SPLICE_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/time.h>    // for minimk_time_monotonic_now
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <fcntl.h>     // for splice
+#include <sys/types.h> // for ssize_t
+
+#include <limits.h> // for SSIZE_MAX
+#include <stddef.h> // for size_t
+
+/// Testable minimk_syscall_splice implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(splice) M_sys_splice = splice>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_splice_impl( //
+        minimk_syscall_socket_t pipefd, minimk_syscall_socket_t sock, size_t count,
+        size_t *nwritten) noexcept {
+    // Initialize output parameter immediately
+    *nwritten = 0;
+
+    // As documented, reject zero-byte writes
+    if (count <= 0) {
+        MINIMK_TRACE_SYSCALL("splice: suspicious fd=%d with zero bytes count=%zu\n", sock, count);
+        return MINIMK_EINVAL;
+    }
+
+    // Move the pages when possible and never block, regardless of the pipe mode
+    unsigned int flags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+    // Log that we're about to invoke the syscall
+    count = (count <= SSIZE_MAX) ? count : SSIZE_MAX;
+    MINIMK_TRACE_SYSCALL("splice: fd_in=%d\n", pipefd);
+    MINIMK_TRACE_SYSCALL("splice: fd_out=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("splice: count=%zu\n", count);
+    MINIMK_TRACE_SYSCALL("splice: t0=%lu\n", minimk_time_monotonic_now());
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_splice(pipefd, nullptr, sock, nullptr, count, flags);
+
+    // Assign the result branchlessly, noting that zero means the pipe writer is gone
+    *nwritten = (rv > 0) ? static_cast<size_t>(rv) : 0;
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : (rv == 0) ? MINIMK_EOF : 0;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("splice: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("splice: nwritten=%zu\n", *nwritten);
+    MINIMK_TRACE_SYSCALL("splice: t1=%lu\n", minimk_time_monotonic_now());
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_SPLICE_LINUX_HPP
@@ -0,0 +1,15 @@
+// File: libminimk/syscall/zerocopy_reap_linux.cpp
+// Purpose: recvmsg(2) with MSG_ERRQUEUE implemented for Linux
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "zerocopy_reap_linux.hpp" // for minimk_syscall_zerocopy_reap_impl
+
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_zerocopy_reap
+
+#include <stdint.h> // for uint32_t
+
+minimk_error_t minimk_syscall_zerocopy_reap(minimk_syscall_socket_t sock, uint32_t *lo,
+                                            uint32_t *hi) noexcept {
+    return minimk_syscall_zerocopy_reap_impl(sock, lo, hi);
+}
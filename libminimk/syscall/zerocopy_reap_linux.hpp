@@ -0,0 +1,80 @@
+// File: libminimk/syscall/zerocopy_reap_linux.hpp
+// Purpose: recvmsg(2) on Linux with MSG_ERRQUEUE for MSG_ZEROCOPY completions
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_SYSCALL_ZEROCOPY_REAP_LINUX_HPP
+#define LIBMINIMK_SYSCALL_ZEROCOPY_REAP_LINUX_HPP
+
+#include <minimk/cdefs.h>   // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>   // for minimk_error_t
+#include <minimk/syscall.h> // for minimk_syscall_geterrno
+#include <minimk/trace.h>   // for MINIMK_TRACE_SYSCALL
+
+#include <linux/errqueue.h> // for struct sock_extended_err
+#include <netinet/in.h>     // for IPPROTO_IP
+#include <sys/socket.h>     // for recvmsg
+#include <sys/types.h>      // for ssize_t
+
+#include <stdint.h> // for uint32_t
+#include <string.h> // for memcpy
+
+/// Testable minimk_syscall_zerocopy_reap implementation.
+template <decltype(minimk_syscall_clearerrno) M_minimk_syscall_clearerrno = minimk_syscall_clearerrno,
+          decltype(minimk_syscall_geterrno) M_minimk_syscall_geterrno = minimk_syscall_geterrno,
+          decltype(recvmsg) M_sys_recvmsg = recvmsg>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_syscall_zerocopy_reap_impl( //
+        minimk_syscall_socket_t sock, uint32_t *lo, uint32_t *hi) noexcept {
+    // Initialize output parameters immediately
+    *lo = 0;
+    *hi = 0;
+
+    // Prepare a message header with room for a single extended error
+    union {
+        char buf[CMSG_SPACE(sizeof(struct sock_extended_err))];
+        struct cmsghdr align;
+    } control = {};
+    struct msghdr msg = {};
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    // Log that we're about to invoke the syscall
+    MINIMK_TRACE_SYSCALL("recvmsg: fd=%d\n", sock);
+    MINIMK_TRACE_SYSCALL("recvmsg: flags=%s\n", "MSG_ERRQUEUE");
+
+    // Clear the errno and issue the syscall
+    M_minimk_syscall_clearerrno();
+    ssize_t rv = M_sys_recvmsg(sock, &msg, MSG_ERRQUEUE);
+    minimk_error_t res = (rv == -1) ? M_minimk_syscall_geterrno() : 0;
+
+    // Find the zero-copy notification, which is valid for both IPv4 and IPv6
+    bool found = false;
+    struct cmsghdr *cmsg = (res == 0) ? CMSG_FIRSTHDR(&msg) : nullptr;
+    for (; cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        bool recverr = (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                       (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+        if (!recverr) {
+            continue;
+        }
+        struct sock_extended_err serr = {};
+        memcpy(&serr, CMSG_DATA(cmsg), sizeof(serr));
+        if (serr.ee_errno != 0 || serr.ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+            continue;
+        }
+        MINIMK_TRACE_SYSCALL("recvmsg: copied=%d\n", (serr.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0);
+        *lo = serr.ee_info;
+        *hi = serr.ee_data;
+        found = true;
+    }
+
+    // Any other message on the error queue is not a completion
+    res = (res == 0 && !found) ? MINIMK_EINVAL : res;
+
+    // Log the results of invoking the syscall
+    MINIMK_TRACE_SYSCALL("recvmsg: result=%s\n", minimk_errno_name(res));
+    MINIMK_TRACE_SYSCALL("recvmsg: lo=%u\n", *lo);
+    MINIMK_TRACE_SYSCALL("recvmsg: hi=%u\n", *hi);
+
+    // Return the result
+    return res;
+}
+
+#endif // LIBMINIMK_SYSCALL_ZEROCOPY_REAP_LINUX_HPP
@@ -0,0 +1,36 @@
+// File: libminimk/tcpinfo/ring.cpp
+// Purpose: fixed-size ring of TCP_INFO samples
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/cdefs.h>   // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/tcpinfo.h> // for minimk_tcpinfo_ring_t
+
+#include <stddef.h> // for size_t
+
+void minimk_tcpinfo_ring_init(minimk_tcpinfo_ring_t *ring, minimk_tcpinfo_t *base, size_t capacity) noexcept {
+    ring->base = base;
+    ring->capacity = (base != nullptr) ? capacity : 0;
+    ring->count = 0;
+}
+
+void minimk_tcpinfo_ring_push(minimk_tcpinfo_ring_t *ring, const minimk_tcpinfo_t *sample) noexcept {
+    // Silently drop samples when there is no storage
+    if (ring->capacity <= 0) {
+        return;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    ring->base[ring->count % ring->capacity] = *sample;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    ring->count++;
+}
+
+const minimk_tcpinfo_t *minimk_tcpinfo_ring_at(const minimk_tcpinfo_ring_t *ring, size_t idx) noexcept {
+    // Only the most recent capacity samples are still available
+    size_t avail = (ring->count < ring->capacity) ? ring->count : ring->capacity;
+    if (idx >= avail) {
+        return nullptr;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    return &ring->base[(ring->count - avail + idx) % ring->capacity];
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
@@ -0,0 +1,129 @@
+// File: libminimk/websocket/accept_key.cpp
+// Purpose: Sec-WebSocket-Accept computation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "base64.hpp" // for minimk_websocket_base64_encode
+
+#include <minimk/cdefs.h>     // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/websocket.h> // for minimk_websocket_accept_key
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint32_t, uint8_t
+#include <string.h> // for memcpy
+
+/// GUID that RFC 6455 appends to the key before hashing.
+static const char websocket_guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+/// Rotate a 32-bit word left.
+static uint32_t minimk_websocket_rol(uint32_t value, unsigned bits) noexcept {
+    return (value << bits) | (value >> (32U - bits));
+}
+
+/// SHA-1 state while hashing.
+struct sha1_state {
+    /// Intermediate hash value.
+    uint32_t h[5];
+
+    /// Padding to align to 8 bytes.
+    uint32_t padding;
+
+    /// Number of bytes hashed so far.
+    uint64_t total;
+
+    /// Partial block waiting for more input.
+    uint8_t block[64];
+};
+
+/// Process one 64-byte block.
+static void minimk_websocket_sha1_block(struct sha1_state *st, const uint8_t *block) noexcept {
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    uint32_t w[80];
+    for (unsigned idx = 0; idx < 16; idx++) {
+        w[idx] = (static_cast<uint32_t>(block[idx * 4]) << 24) |
+                 (static_cast<uint32_t>(block[idx * 4 + 1]) << 16) |
+                 (static_cast<uint32_t>(block[idx * 4 + 2]) << 8) | static_cast<uint32_t>(block[idx * 4 + 3]);
+    }
+    for (unsigned idx = 16; idx < 80; idx++) {
+        w[idx] = minimk_websocket_rol(w[idx - 3] ^ w[idx - 8] ^ w[idx - 14] ^ w[idx - 16], 1);
+    }
+    uint32_t a = st->h[0], b = st->h[1], c = st->h[2], d = st->h[3], e = st->h[4];
+    for (unsigned idx = 0; idx < 80; idx++) {
+        uint32_t f = 0, k = 0;
+        if (idx < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999U;
+        } else if (idx < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1U;
+        } else if (idx < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDCU;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6U;
+        }
+        uint32_t tmp = minimk_websocket_rol(a, 5) + f + e + k + w[idx];
+        e = d;
+        d = c;
+        c = minimk_websocket_rol(b, 30);
+        b = a;
+        a = tmp;
+    }
+    st->h[0] += a;
+    st->h[1] += b;
+    st->h[2] += c;
+    st->h[3] += d;
+    st->h[4] += e;
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+/// Hash count more bytes.
+static void minimk_websocket_sha1_update(struct sha1_state *st, const void *data, size_t count) noexcept {
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < count; idx++) {
+        st->block[st->total % 64] = src[idx];
+        st->total++;
+        if (st->total % 64 == 0) {
+            minimk_websocket_sha1_block(st, st->block);
+        }
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+void minimk_websocket_accept_key(const char *key, size_t keylen, char *accept) noexcept {
+    // The key is short, so a straightforward SHA-1 is enough
+    struct sha1_state st = {};
+    st.h[0] = 0x67452301U;
+    st.h[1] = 0xEFCDAB89U;
+    st.h[2] = 0x98BADCFEU;
+    st.h[3] = 0x10325476U;
+    st.h[4] = 0xC3D2E1F0U;
+    minimk_websocket_sha1_update(&st, key, keylen);
+    minimk_websocket_sha1_update(&st, websocket_guid, sizeof(websocket_guid) - 1);
+
+    // Append the padding and the message length in bits
+    uint64_t bits = st.total * 8;
+    uint8_t pad = 0x80;
+    minimk_websocket_sha1_update(&st, &pad, 1);
+    pad = 0;
+    while (st.total % 64 != 56) {
+        minimk_websocket_sha1_update(&st, &pad, 1);
+    }
+    uint8_t length[8];
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (unsigned idx = 0; idx < 8; idx++) {
+        length[idx] = static_cast<uint8_t>(bits >> (56 - idx * 8));
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    minimk_websocket_sha1_update(&st, length, sizeof(length));
+
+    // Serialize the digest in big endian order and encode it
+    uint8_t digest[20];
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (unsigned idx = 0; idx < 20; idx++) {
+        digest[idx] = static_cast<uint8_t>(st.h[idx / 4] >> (24 - (idx % 4) * 8));
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    minimk_websocket_base64_encode(digest, sizeof(digest), accept);
+}
@@ -0,0 +1,46 @@
+// File: libminimk/websocket/base64.hpp
+// Purpose: base64 encoding for the WebSocket handshake
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_WEBSOCKET_BASE64_HPP
+#define LIBMINIMK_WEBSOCKET_BASE64_HPP
+
+#include <minimk/cdefs.h> // for MINIMK_UNSAFE_BUFFER_USAGE_*
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint8_t, uint32_t
+
+/// Encode count bytes at data using base64 with padding.
+///
+/// The out argument must hold 4 * ((count + 2) / 3) + 1 bytes and receives
+/// a zero-terminated string.
+static inline void minimk_websocket_base64_encode(const uint8_t *data, size_t count, char *out) noexcept {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    size_t idx = 0;
+    for (; idx + 3 <= count; idx += 3) {
+        uint32_t group = (static_cast<uint32_t>(data[idx]) << 16) |
+                         (static_cast<uint32_t>(data[idx + 1]) << 8) | static_cast<uint32_t>(data[idx + 2]);
+        *out++ = alphabet[(group >> 18) & 0x3f];
+        *out++ = alphabet[(group >> 12) & 0x3f];
+        *out++ = alphabet[(group >> 6) & 0x3f];
+        *out++ = alphabet[group & 0x3f];
+    }
+    if (count - idx == 1) {
+        uint32_t group = static_cast<uint32_t>(data[idx]) << 16;
+        *out++ = alphabet[(group >> 18) & 0x3f];
+        *out++ = alphabet[(group >> 12) & 0x3f];
+        *out++ = '=';
+        *out++ = '=';
+    } else if (count - idx == 2) {
+        uint32_t group =
+                (static_cast<uint32_t>(data[idx]) << 16) | (static_cast<uint32_t>(data[idx + 1]) << 8);
+        *out++ = alphabet[(group >> 18) & 0x3f];
+        *out++ = alphabet[(group >> 12) & 0x3f];
+        *out++ = alphabet[(group >> 6) & 0x3f];
+        *out++ = '=';
+    }
+    *out = '\0';
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
+
+#endif // LIBMINIMK_WEBSOCKET_BASE64_HPP
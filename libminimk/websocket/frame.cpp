@@ -0,0 +1,53 @@
+// File: libminimk/websocket/frame.cpp
+// Purpose: WebSocket frame header encoding and masking
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <minimk/cdefs.h>     // for MINIMK_UNSAFE_BUFFER_USAGE_*
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint8_t, uint32_t, uint64_t
+
+size_t minimk_websocket_encode_header(const minimk_websocket_frame_t *frame, uint8_t *out) noexcept {
+    size_t len = 0;
+    uint8_t masked = ((frame->flags & MINIMK_WEBSOCKET_FLAG_MASK) != 0) ? uint8_t{0x80} : uint8_t{0};
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    out[len++] = static_cast<uint8_t>(((frame->flags & MINIMK_WEBSOCKET_FLAG_FIN) != 0 ? 0x80 : 0) |
+                                      (frame->opcode & 0x0f));
+
+    // Use the shortest length encoding, as RFC 6455 requires
+    if (frame->length < 126) {
+        out[len++] = static_cast<uint8_t>(masked | frame->length);
+    } else if (frame->length <= 0xffff) {
+        out[len++] = static_cast<uint8_t>(masked | 126);
+        out[len++] = static_cast<uint8_t>(frame->length >> 8);
+        out[len++] = static_cast<uint8_t>(frame->length);
+    } else {
+        out[len++] = static_cast<uint8_t>(masked | 127);
+        for (unsigned shift = 56;; shift -= 8) {
+            out[len++] = static_cast<uint8_t>(frame->length >> shift);
+            if (shift <= 0) {
+                break;
+            }
+        }
+    }
+
+    if (masked != 0) {
+        out[len++] = static_cast<uint8_t>(frame->maskkey >> 24);
+        out[len++] = static_cast<uint8_t>(frame->maskkey >> 16);
+        out[len++] = static_cast<uint8_t>(frame->maskkey >> 8);
+        out[len++] = static_cast<uint8_t>(frame->maskkey);
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return len;
+}
+
+void minimk_websocket_mask(void *data, size_t count, uint32_t maskkey, uint64_t offset) noexcept {
+    uint8_t *bytes = static_cast<uint8_t *>(data);
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    for (size_t idx = 0; idx < count; idx++) {
+        unsigned shift = 24U - 8U * static_cast<unsigned>((offset + idx) % 4);
+        bytes[idx] = static_cast<uint8_t>(bytes[idx] ^ static_cast<uint8_t>(maskkey >> shift));
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+}
@@ -0,0 +1,17 @@
+// File: libminimk/websocket/handshake.cpp
+// Purpose: client_handshake implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "handshake.hpp" // for minimk_websocket_client_handshake_impl
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/bufwriter.h> // for minimk_bufwriter_t
+#include <minimk/errno.h>     // for minimk_error_t
+
+#include <stdint.h> // for uint8_t
+
+minimk_error_t minimk_websocket_client_handshake(minimk_bufreader_t *reader, minimk_bufwriter_t *writer,
+                                                 const char *host, const char *path, const char *protocol,
+                                                 const uint8_t *nonce) noexcept {
+    return minimk_websocket_client_handshake_impl(reader, writer, host, path, protocol, nonce);
+}
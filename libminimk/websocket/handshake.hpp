@@ -0,0 +1,148 @@
+// File: libminimk/websocket/handshake.hpp
+// Purpose: client_handshake implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_WEBSOCKET_HANDSHAKE_HPP
+#define LIBMINIMK_WEBSOCKET_HANDSHAKE_HPP
+
+#include "base64.hpp" // for minimk_websocket_base64_encode
+
+#include <minimk/bufreader.h> // for minimk_bufreader_read_until
+#include <minimk/bufwriter.h> // for minimk_bufwriter_write
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/websocket.h> // for minimk_websocket_accept_key
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint8_t
+#include <string.h>  // for strlen, memcmp
+#include <strings.h> // for strncasecmp
+
+/// Size of the base64 encoded Sec-WebSocket-Key including the terminating zero.
+#define WEBSOCKET_KEY_SIZE 25
+
+/// Return whether [data, data + len) equals the zero-terminated token.
+static inline bool minimk_websocket_token_equal(const char *data, size_t len, const char *token,
+                                                bool nocase) noexcept {
+    if (strlen(token) != len) {
+        return false;
+    }
+    return nocase ? strncasecmp(data, token, len) == 0 : memcmp(data, token, len) == 0;
+}
+
+/// Return whether the comma-separated [data, data + len) contains the token, ignoring case.
+static inline bool minimk_websocket_token_list_contains(const char *data, size_t len,
+                                                        const char *token) noexcept {
+    size_t start = 0;
+    while (start <= len) {
+        size_t end = start;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        while (end < len && data[end] != ',') {
+            end++;
+        }
+        size_t first = start, last = end;
+        while (first < last && (data[first] == ' ' || data[first] == '\t')) {
+            first++;
+        }
+        while (last > first && (data[last - 1] == ' ' || data[last - 1] == '\t')) {
+            last--;
+        }
+        if (minimk_websocket_token_equal(data + first, last - first, token, true)) {
+            return true;
+        }
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        start = end + 1;
+    }
+    return false;
+}
+
+/// Testable minimk_websocket_client_handshake implementation.
+template <decltype(minimk_bufwriter_write) M_write = minimk_bufwriter_write,
+          decltype(minimk_bufwriter_flush) M_flush = minimk_bufwriter_flush,
+          decltype(minimk_bufreader_read_until) M_read_until = minimk_bufreader_read_until>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_websocket_client_handshake_impl( //
+        minimk_bufreader_t *reader, minimk_bufwriter_t *writer, const char *host, const char *path,
+        const char *protocol, const uint8_t *nonce) noexcept {
+    // Derive the key we send and the accept value we expect back
+    char key[WEBSOCKET_KEY_SIZE];
+    minimk_websocket_base64_encode(nonce, 16, key);
+    char accept[MINIMK_WEBSOCKET_ACCEPT_SIZE];
+    minimk_websocket_accept_key(key, WEBSOCKET_KEY_SIZE - 1, accept);
+
+    // Compose the request, which the writer coalesces into a single send
+    const char *parts[] = {"GET ",
+                           path,
+                           " HTTP/1.1\r\nHost: ",
+                           host,
+                           "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Key: ",
+                           key,
+                           "\r\nSec-WebSocket-Version: 13\r\nSec-WebSocket-Protocol: ",
+                           protocol,
+                           "\r\n\r\n"};
+    for (const char *part : parts) {
+        minimk_error_t rv = M_write(writer, part, strlen(part));
+        if (rv != 0) {
+            return rv;
+        }
+    }
+    minimk_error_t rv = M_flush(writer);
+    if (rv != 0) {
+        return rv;
+    }
+
+    // Make sure the server agreed to switch protocols
+    static const char status[] = "HTTP/1.1 101";
+    minimk_iovec_t view = {};
+    rv = M_read_until(reader, "\r\n", 2, &view);
+    if (rv != 0) {
+        return rv;
+    }
+    if (view.len < sizeof(status) - 1 || memcmp(view.base, status, sizeof(status) - 1) != 0) {
+        return MINIMK_EINVAL;
+    }
+
+    // Check the headers we care about until the empty line
+    bool ok_accept = false, ok_connection = false, ok_protocol = false, ok_upgrade = false;
+    for (;;) {
+        rv = M_read_until(reader, "\r\n", 2, &view);
+        if (rv != 0) {
+            return rv;
+        }
+        const char *line = static_cast<const char *>(view.base);
+        size_t len = view.len - 2;
+        if (len == 0) {
+            break;
+        }
+
+        const void *colon = memchr(line, ':', len);
+        if (colon == nullptr) {
+            return MINIMK_EINVAL;
+        }
+        size_t namelen = static_cast<size_t>(static_cast<const char *>(colon) - line);
+        size_t off = namelen + 1;
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        while (off < len && (line[off] == ' ' || line[off] == '\t')) {
+            off++;
+        }
+        while (len > off && (line[len - 1] == ' ' || line[len - 1] == '\t')) {
+            len--;
+        }
+        const char *value = line + off;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        size_t valuelen = len - off;
+
+        if (minimk_websocket_token_equal(line, namelen, "Sec-WebSocket-Accept", true)) {
+            ok_accept = minimk_websocket_token_equal(value, valuelen, accept, false);
+        } else if (minimk_websocket_token_equal(line, namelen, "Sec-WebSocket-Protocol", true)) {
+            ok_protocol = minimk_websocket_token_equal(value, valuelen, protocol, false);
+        } else if (minimk_websocket_token_equal(line, namelen, "Connection", true)) {
+            // RFC 6455 4.1 requires an Upgrade token, possibly among other tokens
+            ok_connection = minimk_websocket_token_list_contains(value, valuelen, "Upgrade");
+        } else if (minimk_websocket_token_equal(line, namelen, "Upgrade", true)) {
+            ok_upgrade = minimk_websocket_token_equal(value, valuelen, "websocket", true);
+        }
+    }
+    return (ok_accept && ok_connection && ok_protocol && ok_upgrade) ? 0 : MINIMK_EINVAL;
+}
+
+#endif // LIBMINIMK_WEBSOCKET_HANDSHAKE_HPP
@@ -0,0 +1,14 @@
+// File: libminimk/websocket/read_header.cpp
+// Purpose: read_header implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "read_header.hpp" // for minimk_websocket_read_header_impl
+
+#include <minimk/bufreader.h> // for minimk_bufreader_t
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+minimk_error_t minimk_websocket_read_header(minimk_bufreader_t *reader,
+                                            minimk_websocket_frame_t *frame) noexcept {
+    return minimk_websocket_read_header_impl(reader, frame);
+}
@@ -0,0 +1,109 @@
+// File: libminimk/websocket/read_header.hpp
+// Purpose: read_header implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_WEBSOCKET_READ_HEADER_HPP
+#define LIBMINIMK_WEBSOCKET_READ_HEADER_HPP
+
+#include <minimk/bufreader.h> // for minimk_bufreader_read
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint8_t, uint64_t
+
+/// Read exactly count bytes from reader into data.
+template <decltype(minimk_bufreader_read) M_read = minimk_bufreader_read>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_websocket_readall(minimk_bufreader_t *reader, uint8_t *data,
+                                                             size_t count) noexcept {
+    while (count > 0) {
+        size_t nread = 0;
+        minimk_error_t rv = M_read(reader, data, count, &nread);
+        if (rv != 0) {
+            return rv;
+        }
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        data += nread;
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+        count -= nread;
+    }
+    return 0;
+}
+
+/// Testable minimk_websocket_read_header implementation.
+template <decltype(minimk_bufreader_read) M_read = minimk_bufreader_read>
+MINIMK_ALWAYS_INLINE minimk_error_t
+minimk_websocket_read_header_impl(minimk_bufreader_t *reader, minimk_websocket_frame_t *frame) noexcept {
+    *frame = {};
+
+    // Read the fixed part of the header
+    uint8_t buf[8];
+    minimk_error_t rv = minimk_websocket_readall<M_read>(reader, buf, 2);
+    if (rv != 0) {
+        return rv;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    uint8_t b0 = buf[0];
+    uint8_t b1 = buf[1];
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    if ((b0 & 0x70) != 0) {
+        return MINIMK_EINVAL;
+    }
+    frame->opcode = b0 & 0x0fU;
+    frame->flags = ((b0 & 0x80) != 0 ? MINIMK_WEBSOCKET_FLAG_FIN : 0U) |
+                   ((b1 & 0x80) != 0 ? MINIMK_WEBSOCKET_FLAG_MASK : 0U);
+
+    // Reject the reserved opcodes
+    switch (frame->opcode) {
+    case MINIMK_WEBSOCKET_OPCODE_CONTINUATION:
+    case MINIMK_WEBSOCKET_OPCODE_TEXT:
+    case MINIMK_WEBSOCKET_OPCODE_BINARY:
+    case MINIMK_WEBSOCKET_OPCODE_CLOSE:
+    case MINIMK_WEBSOCKET_OPCODE_PING:
+    case MINIMK_WEBSOCKET_OPCODE_PONG:
+        break;
+    default:
+        return MINIMK_EINVAL;
+    }
+
+    // Decode the extended payload length
+    uint64_t length = b1 & 0x7fU;
+    size_t extra = (length == 126) ? 2 : (length == 127) ? 8 : 0;
+    if (extra > 0) {
+        rv = minimk_websocket_readall<M_read>(reader, buf, extra);
+        if (rv != 0) {
+            return rv;
+        }
+        length = 0;
+        for (size_t idx = 0; idx < extra; idx++) {
+            MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+            length = (length << 8) | buf[idx];
+            MINIMK_UNSAFE_BUFFER_USAGE_END
+        }
+        if ((length >> 63) != 0) {
+            return MINIMK_EINVAL;
+        }
+    }
+    frame->length = length;
+
+    // Control frames cannot be fragmented and carry at most 125 bytes
+    if (frame->opcode >= MINIMK_WEBSOCKET_OPCODE_CLOSE &&
+        ((frame->flags & MINIMK_WEBSOCKET_FLAG_FIN) == 0 || frame->length > 125)) {
+        return MINIMK_EINVAL;
+    }
+
+    // Read the masking key when present
+    if ((frame->flags & MINIMK_WEBSOCKET_FLAG_MASK) != 0) {
+        rv = minimk_websocket_readall<M_read>(reader, buf, 4);
+        if (rv != 0) {
+            return rv;
+        }
+        MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+        frame->maskkey = (static_cast<uint32_t>(buf[0]) << 24) | (static_cast<uint32_t>(buf[1]) << 16) |
+                         (static_cast<uint32_t>(buf[2]) << 8) | static_cast<uint32_t>(buf[3]);
+        MINIMK_UNSAFE_BUFFER_USAGE_END
+    }
+    return 0;
+}
+
+#endif // LIBMINIMK_WEBSOCKET_READ_HEADER_HPP
@@ -0,0 +1,14 @@
+// File: libminimk/websocket/send_frame.cpp
+// Purpose: send_frame implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "send_frame.hpp" // for minimk_websocket_send_frame_impl
+
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/socket.h>    // for minimk_socket_t
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+minimk_error_t minimk_websocket_send_frame(minimk_socket_t sock, const minimk_websocket_frame_t *frame,
+                                           const void *payload) noexcept {
+    return minimk_websocket_send_frame_impl(sock, frame, payload);
+}
@@ -0,0 +1,37 @@
+// File: libminimk/websocket/send_frame.hpp
+// Purpose: send_frame implementation
+// SPDX-License-Identifier: GPL-3.0-or-later
+#ifndef LIBMINIMK_WEBSOCKET_SEND_FRAME_HPP
+#define LIBMINIMK_WEBSOCKET_SEND_FRAME_HPP
+
+#include <minimk/cdefs.h>     // for MINIMK_ALWAYS_INLINE
+#include <minimk/errno.h>     // for minimk_error_t
+#include <minimk/iovec.h>     // for minimk_iovec_t
+#include <minimk/socket.h>    // for minimk_socket_sendallv
+#include <minimk/websocket.h> // for minimk_websocket_frame_t
+
+#include <stddef.h> // for size_t
+#include <stdint.h> // for uint8_t
+
+/// Testable minimk_websocket_send_frame implementation.
+template <decltype(minimk_socket_sendallv) M_sendallv = minimk_socket_sendallv>
+MINIMK_ALWAYS_INLINE minimk_error_t minimk_websocket_send_frame_impl(minimk_socket_t sock,
+                                                                     const minimk_websocket_frame_t *frame,
+                                                                     const void *payload) noexcept {
+    // Gather the header and the payload, so the kernel sees a single write
+    uint8_t header[MINIMK_WEBSOCKET_MAX_HEADER];
+    minimk_iovec_t iov[2];
+    size_t iovcnt = 1;
+    MINIMK_UNSAFE_BUFFER_USAGE_BEGIN
+    iov[0].base = header;
+    iov[0].len = minimk_websocket_encode_header(frame, header);
+    if (frame->length > 0) {
+        iov[1].base = const_cast<void *>(payload);
+        iov[1].len = static_cast<size_t>(frame->length);
+        iovcnt = 2;
+    }
+    MINIMK_UNSAFE_BUFFER_USAGE_END
+    return M_sendallv(sock, iov, iovcnt);
+}
+
+#endif // LIBMINIMK_WEBSOCKET_SEND_FRAME_HPP